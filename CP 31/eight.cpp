@@ -1,22 +1,97 @@
 #include <bits/stdc++.h>
+#include <immintrin.h>
 using namespace std;
 
+// Whole input in one buffer, integers pulled out on demand
+static vector<char> in_buf;
+static size_t in_pos, in_len;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+    in_len = len;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+// Skipping tokens only needs their starts: a byte > ' ' right after a byte
+// <= ' '. Both skippers stop at the start of token k + 1 (or the end).
+
+size_t skip_tokens_scalar(const char *s, size_t pos, size_t len, long long k) {
+    bool prev_ws = pos == 0 || (unsigned char)s[pos - 1] <= ' ';
+    for (; pos < len; pos++) {
+        bool ws = (unsigned char)s[pos] <= ' ';
+        if (prev_ws && !ws && k-- == 0) return pos;
+        prev_ws = ws;
+    }
+    return len;
+}
+
+// 64 bytes per round: whitespace bitmask from max_epu8 + cmpeq + movemask,
+// starts = ~ws & (ws << 1), and popcount says how many tokens went by.
+// The block holding the last start is resolved with a few bit clears.
+__attribute__((target("avx2,popcnt"))) size_t skip_tokens_avx2(const char *s, size_t pos, size_t len, long long k) {
+    unsigned long long prev_ws = pos == 0 || (unsigned char)s[pos - 1] <= ' ';
+    const __m256i sp = _mm256_set1_epi8(' ');
+    for (; pos + 64 <= len; pos += 64) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)(s + pos));
+        __m256i hi = _mm256_loadu_si256((const __m256i *)(s + pos + 32));
+        unsigned long long ws = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(lo, sp), sp)) |
+                                (unsigned long long)(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(hi, sp), sp)) << 32;
+        unsigned long long starts = ~ws & (ws << 1 | prev_ws);
+        prev_ws = ws >> 63;
+        long long c = __builtin_popcountll(starts);
+        if (c > k) {
+            while (k-- > 0) starts &= starts - 1;
+            return pos + __builtin_ctzll(starts);
+        }
+        k -= c;
+    }
+    return skip_tokens_scalar(s, pos, len, k);
+}
+
+const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+
+// Pass over the next k integers without converting them
+void skip_ints(long long k) {
+    if (k <= 0) return;
+    in_pos = has_avx2 ? skip_tokens_avx2(in_buf.data(), in_pos, in_len, k)
+                      : skip_tokens_scalar(in_buf.data(), in_pos, in_len, k);
+}
+
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
+    read_all();
+    string out;
 
-    int t;
-    cin >> t;
+    int t = read_int();
     while (t--) {
-        int n, k;               
-        cin >> n >> k;
+        int n = read_int(), k = read_int();
         bool found = false;
-        // If ke exists then its always yes
-        for (int i = 0, x; i < n; ++i) {
-            cin >> x;
-            if (x == k) found = true;
+        // If ke exists then its always yes, the rest of the array doesn't matter
+        for (int i = 0; i < n; ++i) {
+            if (read_int() == k) {
+                found = true;
+                skip_ints(n - i - 1);
+                break;
+            }
         }
-        cout << (found ? "YES\n" : "NO\n");
+        out += found ? "YES\n" : "NO\n";
     }
+    fwrite(out.data(), 1, out.size(), stdout);
     return 0;
 }
@@ -1,6 +1,70 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// One pass over an int array for any mix of: sorted (non-decreasing), min,
+// max, argmin (first index of the min), 64-bit sum, count of elements == k.
+// Want picks the parts at compile time, the rest costs nothing. The main
+// loop keeps 8 lanes of each (GCC vector extensions), merges them at the
+// end, and finishes the tail one by one. Indices must fit in an int.
+typedef int i32x8 __attribute__((vector_size(32)));
+typedef long long i64x8 __attribute__((vector_size(64)));
+
+enum : unsigned { R_SORTED = 1, R_MIN = 2, R_MAX = 4, R_ARGMIN = 8, R_SUM = 16, R_COUNT_EQ = 32 };
+
+struct Summary {
+    bool sorted = true;
+    int min = INT_MAX, max = INT_MIN;
+    int argmin = -1;
+    long long sum = 0;
+    int count_eq = 0;
+};
+
+template <unsigned Want>
+Summary reduce(const int *a, int n, int k = 0) {
+    constexpr bool want_min = Want & (R_MIN | R_ARGMIN);
+    Summary r;
+    int i = 0;
+    if (n >= 9) {
+        i32x8 unsorted = {}, vmin = (i32x8){} + INT_MAX, vmax = (i32x8){} + INT_MIN;
+        i32x8 idx = {0, 1, 2, 3, 4, 5, 6, 7}, vargmin = idx, vcnt = {};
+        i64x8 vsum = {};
+        // a[i + 8] is read for the sorted check, so stop one short
+        for (; i + 9 <= n; i += 8, idx += 8) {
+            i32x8 x;
+            memcpy(&x, a + i, sizeof x);
+            if constexpr (Want & R_SORTED) {
+                i32x8 y;
+                memcpy(&y, a + i + 1, sizeof y);
+                unsorted |= x > y;
+            }
+            if constexpr (want_min) {
+                i32x8 lt = x < vmin;
+                if constexpr (Want & R_ARGMIN) vargmin = lt ? idx : vargmin;
+                vmin = lt ? x : vmin;
+            }
+            if constexpr (Want & R_MAX) vmax = x > vmax ? x : vmax;
+            if constexpr (Want & R_SUM) vsum += __builtin_convertvector(x, i64x8);
+            if constexpr (Want & R_COUNT_EQ) vcnt -= x == k;
+        }
+        for (int l = 0; l < 8; l++) {
+            if (unsorted[l]) r.sorted = false;
+            if (r.argmin < 0 || vmin[l] < r.min || (vmin[l] == r.min && vargmin[l] < r.argmin)) r.min = vmin[l], r.argmin = vargmin[l];
+            r.max = max(r.max, vmax[l]);
+            r.sum += vsum[l];
+            r.count_eq += vcnt[l];
+        }
+    }
+    for (; i < n; i++) {
+        int x = a[i];
+        if constexpr (Want & R_SORTED) if (i + 1 < n && x > a[i + 1]) r.sorted = false;
+        if constexpr (want_min) if (r.argmin < 0 || x < r.min) r.min = x, r.argmin = i;
+        if constexpr (Want & R_MAX) r.max = max(r.max, x);
+        if constexpr (Want & R_SUM) r.sum += x;
+        if constexpr (Want & R_COUNT_EQ) r.count_eq += x == k;
+    }
+    return r;
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -15,13 +79,14 @@ int main() {
         // Main idea here is that there is no way to move first element
         // So if to be sorted the first elemnt should be min in all
         // If already sorted → YES for this case, move to next
-        if (is_sorted(p.begin(), p.end())) {
+        // (both checks come from one pass over p)
+        Summary s = reduce<R_SORTED | R_MIN>(p.data(), n);
+        if (s.sorted) {
             cout << "YES\n";
             continue;
         }
 
-        int mn = *min_element(p.begin(), p.end());
-        if (p[0] == mn)
+        if (p[0] == s.min)
             cout << "YES\n";
         else
             cout << "NO\n";
@@ -1,6 +1,31 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// s is a substring of x doubled k times exactly when it shows up in the
+// first n * 2^k characters of x x x x ..., so one KMP pass over that endless
+// text (read as x[i % n], never built) finds the first occurrence, and its
+// end decides k. Stops at the first match or after 32n characters.
+// Returns the end (exclusive) of the first match, or -1.
+long long first_match_end(const string &x, const string &s, long long limit) {
+    int n = x.size(), m = s.size();
+    vector<int> fail(m, 0);
+    for (int i = 1, k = 0; i < m; i++) {
+        while (k > 0 && s[i] != s[k]) k = fail[k - 1];
+        if (s[i] == s[k]) k++;
+        fail[i] = k;
+    }
+
+    int k = 0, j = 0; // j = i % n
+    for (long long i = 0; i < limit; i++) {
+        char c = x[j];
+        if (++j == n) j = 0;
+        while (k > 0 && c != s[k]) k = fail[k - 1];
+        if (c == s[k]) k++;
+        if (k == m) return i + 1;
+    }
+    return -1;
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -19,27 +44,14 @@ int main() {
         // Means we have to do atleast 5 oprations to make s substring of 32
         // And if s does not exist in x(32) means it will not exist in x(64)
         // Means we can check at 5 operations of concatioantion
-        string x2 = x + x;
-        string x4 = x2 + x2;
-        string x8 = x4 + x4;
-        string x16 = x8 + x8;
-        string x32 = x16 + x16;
+        const int MAX_OPS = 5;
+        long long end = first_match_end(x, s, (long long)n << MAX_OPS);
         int ans = -1;
-        // Here we exert if the find fnc returns not found then we not enter the case
-        if (x.find(s) != string::npos) {
+        if (end != -1) {
             ans = 0;
-        } else if (x2.find(s) != string::npos) {
-            ans = 1;
-        } else if (x4.find(s) != string::npos) {
-            ans = 2;
-        } else if (x8.find(s) != string::npos) {
-            ans = 3;
-        } else if (x16.find(s) != string::npos) {
-            ans = 4;
-        } else if (x32.find(s) != string::npos) {
-            ans = 5;
+            while (((long long)n << ans) < end) ans++;
         }
         cout << ans << '\n';
     }
     return 0;
-}
\ No newline at end of file
+}
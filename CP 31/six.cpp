@@ -1,37 +1,94 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Whole input in one buffer, integers pulled out on demand
+static vector<char> in_buf;
+static size_t in_pos;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+// Pass over the next k integers without converting them
+void skip_ints(long long k) {
+    const char *s = in_buf.data();
+    while (k-- > 0) {
+        while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+        if (s[in_pos] == '-') ++in_pos;
+        while (s[in_pos] >= '0' && s[in_pos] <= '9') ++in_pos;
+    }
+}
+
+// Counts of up to K distinct values, kept inline. add() refuses the
+// (K + 1)-th distinct value, so the caller can stop reading right there.
+template <class T, int K>
+struct DistinctProfile {
+    T val[K];
+    int cnt[K];
+    int size = 0;
+
+    bool add(const T &v) {
+        for (int i = 0; i < size; i++)
+            if (val[i] == v) {
+                cnt[i]++;
+                return true;
+            }
+        if (size == K) return false;
+        val[size] = v;
+        cnt[size++] = 1;
+        return true;
+    }
+};
+
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
+    read_all();
+    string out;
 
     // Taking inputs
-    int T;
-    cin >> T;
+    int T = read_int();
     while (T--) {
-        int n;                 cin >> n;
-        vector<int> a(n);
-        for (int &x : a) cin >> x;
+        int n = read_int();
         // Main ideas is to calculate frequency of every odd place and even place common element
-        unordered_map<int,int> freq;
-        for (int x : a) ++freq[x];
-        if (freq.size() == 1) {   
-            cout << "YES\n";
+        // A third distinct value already means NO, the rest of the array is skipped
+        DistinctProfile<int, 2> freq;
+        int i = 0;
+        while (i < n && freq.add(read_int())) i++;
+        if (i < n) {
+            skip_ints(n - i - 1);
+            out += "NO\n";
             continue;
         }
-        if (freq.size() > 2) {             
-            cout << "NO\n";
+        if (freq.size == 1) {
+            out += "YES\n";
             continue;
         }
-        auto it = freq.begin();
-        int c1 = it->second;   ++it;
-        int c2 = it->second;
+        int c1 = freq.cnt[0];
+        int c2 = freq.cnt[1];
         if (n % 2 == 0) {
-            cout << (c1 == n/2 && c2 == n/2 ? "YES\n" : "NO\n");
+            out += c1 == n/2 && c2 == n/2 ? "YES\n" : "NO\n";
         } else {
             int bigger = max(c1, c2), smaller = min(c1, c2);
-            cout << (bigger == n/2 + 1 && smaller == n/2 ? "YES\n" : "NO\n");
+            out += bigger == n/2 + 1 && smaller == n/2 ? "YES\n" : "NO\n";
         }
     }
+    fwrite(out.data(), 1, out.size(), stdout);
     return 0;
 }
@@ -1,21 +1,100 @@
 #include <iostream>
 #include <vector>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
 using namespace std;
 
+// The 10x10 grid as a bitboard: cell (i, j) is bit 10 * i + j, bits 0..63
+// in w[0] and 64..99 in w[1].
+struct Board {
+    unsigned long long w[2] = {};
+
+    constexpr void set(int cell) { w[cell >> 6] |= 1ULL << (cell & 63); }
+};
+
+// Ring k (0-based) is every cell whose distance to the nearest border is k,
+// and an 'X' there is worth k + 1 points
+constexpr int RINGS = 5;
+
+struct RingMasks {
+    Board ring[RINGS];
+
+    constexpr RingMasks() {
+        for (int i = 0; i < 10; i++)
+            for (int j = 0; j < 10; j++) {
+                int k = min(min(i, j), min(9 - i, 9 - j));
+                ring[k].set(10 * i + j);
+            }
+    }
+};
+
+constexpr RingMasks rings;
+
+static_assert(__builtin_popcountll(rings.ring[0].w[0]) + __builtin_popcountll(rings.ring[0].w[1]) == 36,
+              "the border ring has 36 cells");
+
+int score(const Board &b) {
+    int total = 0;
+    for (int k = 0; k < RINGS; k++)
+        total += (k + 1) * (__builtin_popcountll(b.w[0] & rings.ring[k].w[0]) +
+                            __builtin_popcountll(b.w[1] & rings.ring[k].w[1]));
+    return total;
+}
+
+// Bit j set when p[j] == 'X', for the 10 bytes at p. The first 8 go through
+// SWAR: exact zero-byte test on p ^ "XXXXXXXX", then a multiply gathers the
+// eight high bits into one byte.
+unsigned row_bits(const char *p) {
+    unsigned long long x;
+    memcpy(&x, p, 8);
+    x ^= 0x5858585858585858ULL; // 'X' bytes become 0
+    unsigned long long hi = (((x & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | x) & 0x8080808080808080ULL;
+    unsigned bits = ((hi ^ 0x8080808080808080ULL) * 0x0002040810204081ULL) >> 56;
+    return bits | (p[8] == 'X') << 8 | (p[9] == 'X') << 9;
+}
+
+// Batched mode: the whole input is read at once and boards are parsed and
+// scored straight from the buffer, answers go out in one write
+static vector<char> in_buf;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.resize(len + 16, 0); // row_bits may look a few bytes past the last row
+}
+
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
+    read_all();
+    const char *p = in_buf.data();
+
+    auto skip_space = [&]() {
+        while (*p && (unsigned char)*p <= ' ') ++p;
+    };
+
+    skip_space();
+    int t = 0;
+    while (*p >= '0' && *p <= '9') t = t * 10 + (*p++ - '0');
 
-    int t;
-    cin >> t;
+    string out;
+    char num[16];
     while (t--) {
-        int total = 0;
+        Board b;
         for (int i = 0; i < 10; ++i) {
-            string row;
-            cin >> row;
+            skip_space();
+            unsigned long long row = row_bits(p);
+            p += 10;
+            int at = 10 * i;
+            b.w[at >> 6] |= row << (at & 63);
+            if ((at & 63) > 54) b.w[1] |= row >> (64 - (at & 63)); // row 6 straddles the words
         }
-        // Now we iterate through the matrix
 
         // When i == 0 and X we say +1
         // Similarly when j == 0 and X we say +1
@@ -24,7 +103,10 @@ int main() {
         
         // and between cells (2,2) to (2,7) and X We way +2
         // and between cells (2,2) to (7,2) and ...
-        cout << total << "\n";
+        int total = score(b);
+        int len = snprintf(num, sizeof num, "%d\n", total);
+        out.append(num, len);
     }
+    fwrite(out.data(), 1, out.size(), stdout);
     return 0;
 }
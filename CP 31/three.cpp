@@ -1,6 +1,83 @@
 #include <bits/stdc++.h>
+#include <immintrin.h>
 using namespace std;
 
+// Runs of at least L copies of byte c, 64 bytes at a time: the block becomes
+// a bitmask (bit k set when byte k is c), runs inside it are found by
+// AND-ing the mask with shifted copies of itself, and the c's are counted
+// with popcount. The AVX2 version builds the mask with cmpeq + movemask and
+// is only called when the CPU has it. Nothing here reads outside [0, n).
+
+struct RunScan {
+    bool found;   // a run of length >= L exists
+    size_t count; // number of c bytes, only complete when !found
+};
+
+// tail = length of the run of c that ends right before this block
+static inline bool block_has_run(unsigned long long m, int L, size_t &tail) {
+    unsigned long long gaps = ~m;
+    size_t lead = gaps ? __builtin_ctzll(gaps) : 64;
+    if (tail + lead >= (size_t)L) return true;
+    if (L <= 64) {
+        // bit i of r: bytes i .. i + have - 1 are all c
+        unsigned long long r = m;
+        for (int have = 1; have < L && r;) {
+            int s = min(have, L - have);
+            r &= r >> s;
+            have += s;
+        }
+        if (r) return true;
+    }
+    tail = gaps ? __builtin_clzll(gaps) : tail + 64;
+    return false;
+}
+
+static inline unsigned long long byte_mask_scalar(const char *p, size_t len, char c) {
+    unsigned long long m = 0;
+    for (size_t k = 0; k < len; k++) m |= (unsigned long long)(p[k] == c) << k;
+    return m;
+}
+
+RunScan scan_runs_scalar(const char *p, size_t n, char c, int L) {
+    RunScan res{false, 0};
+    size_t tail = 0;
+    for (size_t i = 0; i < n; i += 64) {
+        unsigned long long m = byte_mask_scalar(p + i, min<size_t>(64, n - i), c);
+        if (block_has_run(m, L, tail)) return res.found = true, res;
+        res.count += __builtin_popcountll(m);
+    }
+    return res;
+}
+
+__attribute__((target("avx2,popcnt"))) static inline unsigned long long byte_mask_avx2(const char *p, __m256i cc) {
+    __m256i lo = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)p), cc);
+    __m256i hi = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(p + 32)), cc);
+    return (unsigned)_mm256_movemask_epi8(lo) | (unsigned long long)(unsigned)_mm256_movemask_epi8(hi) << 32;
+}
+
+__attribute__((target("avx2,popcnt"))) RunScan scan_runs_avx2(const char *p, size_t n, char c, int L) {
+    RunScan res{false, 0};
+    size_t tail = 0, i = 0;
+    __m256i cc = _mm256_set1_epi8(c);
+    for (; i + 64 <= n; i += 64) {
+        unsigned long long m = byte_mask_avx2(p + i, cc);
+        if (block_has_run(m, L, tail)) return res.found = true, res;
+        res.count += __builtin_popcountll(m);
+    }
+    if (i < n) {
+        unsigned long long m = byte_mask_scalar(p + i, n - i, c);
+        if (block_has_run(m, L, tail)) return res.found = true, res;
+        res.count += __builtin_popcountll(m);
+    }
+    return res;
+}
+
+const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+
+RunScan scan_runs(const char *p, size_t n, char c, int L) {
+    return has_avx2 ? scan_runs_avx2(p, n, c, L) : scan_runs_scalar(p, n, c, L);
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -12,26 +89,13 @@ int main() {
         string cells;
         cin >> n >> cells;
 
-        int emptyCnt = 0;          // total empty cells ('.')
-        int streak   = 0;          // current consecutive empties
-        bool done    = false;      // whether we've already printed
-
-        for (int i = 0; i < n; ++i) {
-            if (cells[i] == '#') {   // blocked cell
-                streak = 0;
-            } else {                 // empty cell
-                ++streak;
-                ++emptyCnt;
-                if (streak == 3) {   // three in a row → answer is always 2
-                    cout << 2 << '\n';
-                    done = true;
-                    break;
-                }
-            }
-        }
-
-        if (!done) {
-            cout << emptyCnt << '\n';   // no three‑in‑a‑row block found
+        // three empties ('.') in a row → answer is always 2,
+        // otherwise it's the number of empty cells
+        RunScan r = scan_runs(cells.data(), n, '.', 3);
+        if (r.found) {
+            cout << 2 << '\n';
+        } else {
+            cout << r.count << '\n';
         }
     }
     return 0;
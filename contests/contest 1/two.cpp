@@ -5,105 +5,292 @@ using int64 = long long;
 using i128  = __int128_t;   
 
 
-void print_int128(i128 x) {
-    if (x == 0) { std::cout << 0; return; }
-    if (x < 0) { std::cout << '-'; x = -x; }
+void print_int128(i128 x, string &out) {
+    if (x == 0) { out += '0'; return; }
+    if (x < 0) { out += '-'; x = -x; }
     std::string s;
     while (x) { s.push_back(char('0' + x % 10)); x /= 10; }
     std::reverse(s.begin(), s.end());
-    std::cout << s;
+    out += s;
 }
 
 
-int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
+// Whole input in one buffer
+static vector<char> in_buf;
 
-    int Tcs;                           
-    cin >> Tcs;
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+}
 
-    while (Tcs--) {
-        int n; int64 k;
-        cin >> n >> k;
+// Integers from some point of in_buf on
+struct Reader {
+    const char *p;
 
-        vector<int64> a(n);
-        int64 totalCars = 0;
-        for (int i = 0; i < n; ++i) { cin >> a[i]; totalCars += a[i]; }
+    long long next_int() {
+        while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+        bool neg = *p == '-';
+        if (neg) ++p;
+        long long x = 0;
+        while (*p >= '0' && *p <= '9') x = x * 10 + (*p++ - '0');
+        return neg ? -x : x;
+    }
 
-        auto count_leq = [&](int64 val) -> int64 {
-            int64 cnt = 0;
-            for (int i = 0; i < n; ++i) {
-                int64 ai = a[i];
+    // pass over k integers without converting them
+    void skip(long long k) {
+        while (k-- > 0) {
+            while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+            if (*p == '-') ++p;
+            while (*p >= '0' && *p <= '9') ++p;
+        }
+    }
+};
 
-                // sequence‑1: costs j‑k, 1 ≤ j ≤ ai        (cost ≤ val ⇔ j ≤ val + k)
-                if (val + k >= 1) cnt += std::min<int64>(ai, val + k);
+// Threads one case may start for itself in parallel_parts. The runner gives
+// each worker its share of the cores, so big cases on several workers don't
+// multiply into hardware_concurrency() squared threads.
+int case_threads = 1;
+
+// Multi-test runner, the same as in lvl2/module_2/day2_1.cpp: one input
+// span per case (found with skip_case), solve(r, out) on a work-stealing
+// pool, answers written out in input order. Here it also sets case_threads.
+template <class Skip, class Solve>
+void run_cases(Skip skip_case, Solve solve) {
+    read_all();
+    Reader in{in_buf.data()};
+    int T = in.next_int();
+    vector<const char *> start(T + 1);
+    for (int c = 0; c < T; c++) {
+        start[c] = in.p;
+        skip_case(in);
+    }
+    start[T] = in.p;
+
+    int hw = max(1u, thread::hardware_concurrency());
+    int threads = min(hw, max(T, 1));
+    case_threads = max(1, hw / threads);
+
+    // cases [lo, hi) still to do, the owner takes lo, thieves take the back half
+    struct Range {
+        mutex m;
+        int lo = 0, hi = 0;
+    };
+    vector<Range> ranges(threads);
+    size_t bytes = start[T] - start[0];
+    for (int t = 0, c = 0; t < threads; t++) {
+        size_t goal = bytes * (t + 1) / threads;
+        ranges[t].lo = c;
+        while (c < T && (size_t)(start[c + 1] - start[0]) <= goal) c++;
+        if (t == threads - 1) c = T;
+        ranges[t].hi = c;
+    }
 
-                // sequence‑2: costs j, j = ai+1 …           (cost ≤ val ⇔ j ≤ val)
-                if (val > ai)   cnt += val - ai;
+    auto take = [&](int t, int &c) {
+        lock_guard<mutex> g(ranges[t].m);
+        if (ranges[t].lo == ranges[t].hi) return false;
+        c = ranges[t].lo++;
+        return true;
+    };
+    auto steal = [&](int t) {
+        for (int k = 1; k < threads; k++) {
+            Range &victim = ranges[(t + k) % threads];
+            int lo, hi;
+            {
+                lock_guard<mutex> g(victim.m);
+                if (victim.lo == victim.hi) continue;
+                hi = victim.hi;
+                lo = hi - (hi - victim.lo + 1) / 2;
+                victim.hi = lo;
             }
-            return cnt;
-        };
-
-        // ---- binary search for the threshold cost “lim” ----
-        int64 lo = 1 - k;              // smallest possible marginal cost (when j = 1)
-        int64 hi = 1;                  // grow until enough tickets are available
-        while (count_leq(hi) < totalCars) hi <<= 1;
-
-        while (lo < hi) {
-            int64 mid = lo + ((hi - lo) >> 1);
-            if (count_leq(mid) >= totalCars) hi = mid;
-            else                             lo = mid + 1;
+            lock_guard<mutex> g(ranges[t].m);
+            ranges[t].lo = lo, ranges[t].hi = hi;
+            return true;
         }
-        int64 lim = lo;                // first cost value with ≥ totalCars tickets
+        return false;
+    };
 
-        // ---- decide how many cars each lane finally gets ----
-        vector<int64> finalCnt(n);     // di for each lane
-        vector<int> exactEq(n);        // tickets whose cost == lim in this lane
-        int64 assigned = 0;
+    // answer of case c is out[piece[c].t] from piece[c].from to piece[c].to
+    struct Piece {
+        int t;
+        size_t from, to;
+    };
+    vector<string> out(threads);
+    vector<Piece> piece(T);
+    auto worker = [&](int t) {
+        int c;
+        do {
+            while (take(t, c)) {
+                Reader r{start[c]};
+                size_t from = out[t].size();
+                solve(r, out[t]);
+                piece[c] = {t, from, out[t].size()};
+            }
+        } while (steal(t));
+    };
 
-        for (int i = 0; i < n; ++i) {
-            int64 ai   = a[i];
-            int64 cnt1 = 0, cnt2 = 0;
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto &th : pool) th.join();
 
-            if (lim + k >= 1) cnt1 = std::min<int64>(ai, lim + k);
-            if (lim > ai)     cnt2 = lim - ai;
+    size_t total = 0;
+    for (auto &s : out) total += s.size();
+    string all;
+    all.reserve(total);
+    for (int c = 0; c < T; c++) all.append(out[piece[c].t], piece[c].from, piece[c].to - piece[c].from);
+    fwrite(all.data(), 1, all.size(), stdout);
+}
 
-            finalCnt[i] = cnt1 + cnt2;
-            assigned   += finalCnt[i];
 
-            int eq = 0;
-            int64 j1 = lim + k;            // j with cost lim in sequence‑1?
-            if (1 <= j1 && j1 <= ai) ++eq; // yes, exactly one such j
-            if (lim > ai) ++eq;            // sequence‑2 also contributes one
-            exactEq[i] = eq;
-        }
+// LSD radix sort, 11 bits per pass, only as many passes as max - min needs
+void radix_sort(vector<int64> &v) {
+    if (v.empty()) return;
+    int64 mn = *min_element(v.begin(), v.end());
+    unsigned long long span = 0;
+    for (int64 x : v) span = max<unsigned long long>(span, (unsigned long long)(x - mn));
+    vector<int64> tmp(v.size());
+    for (int shift = 0; shift < 64 && (span >> shift); shift += 11) {
+        size_t cnt[2049] = {};
+        for (int64 x : v) ++cnt[(((unsigned long long)(x - mn) >> shift) & 2047) + 1];
+        for (int d = 0; d < 2048; ++d) cnt[d + 1] += cnt[d];
+        for (int64 x : v) tmp[cnt[((unsigned long long)(x - mn) >> shift) & 2047]++] = x;
+        v.swap(tmp);
+    }
+}
+
+
+// Runs fn(part, lo, hi) over [0, n) split into contiguous parts, one thread
+// each, at most case_threads of them. Small inputs stay on the calling thread.
+template <class F>
+int parallel_parts(int n, F fn) {
+    int parts = 1;
+    if (n >= (1 << 16)) parts = max(1, min(case_threads, 64));
+    vector<thread> pool;
+    for (int p = 1; p < parts; ++p)
+        pool.emplace_back(fn, p, (int)(int64(n) * p / parts), (int)(int64(n) * (p + 1) / parts));
+    fn(0, 0, (int)(int64(n) / parts));
+    for (auto &t : pool) t.join();
+    return parts;
+}
+
+
+// One case: n k, then a
+void solve(Reader &in, string &out) {
+    int n = in.next_int();
+    int64 k = in.next_int();
 
-        // remove surplus cars that had cost == lim
-        int64 surplus = assigned - totalCars;
-        for (int i = 0; surplus && i < n; ++i) {
-            int64 take = std::min<int64>(exactEq[i], surplus);
-            finalCnt[i] -= take;
-            surplus     -= take;
+    vector<int64> a(n);
+    int64 totalCars = 0;
+    for (int i = 0; i < n; ++i) { a[i] = in.next_int(); totalCars += a[i]; }
+
+    // lanes sorted by a, with prefix sums, so count_leq is two binary searches
+    vector<int64> sorted_a = a;
+    radix_sort(sorted_a);
+    vector<int64> pre(n + 1, 0);
+    for (int i = 0; i < n; ++i) pre[i + 1] = pre[i] + sorted_a[i];
+
+    auto count_leq = [&](int64 val) -> int64 {
+        int64 cnt = 0;
+
+        // sequence‑1: costs j‑k, 1 ≤ j ≤ ai        (cost ≤ val ⇔ j ≤ val + k)
+        // Σ min(ai, val + k): lanes with ai ≤ val + k give ai, the rest val + k
+        if (val + k >= 1) {
+            int64 t = val + k;
+            int m = upper_bound(sorted_a.begin(), sorted_a.end(), t) - sorted_a.begin();
+            cnt += pre[m] + (n - m) * t;
         }
 
-        // ---- compute total angriness ----
-        i128 answer = i128(k) * i128(totalCars);   // constant baseline k * Σai
+        // sequence‑2: costs j, j = ai+1 …           (cost ≤ val ⇔ j ≤ val)
+        // Σ (val − ai) over lanes with ai < val
+        int m = lower_bound(sorted_a.begin(), sorted_a.end(), val) - sorted_a.begin();
+        cnt += m * val - pre[m];
+        return cnt;
+    };
 
-        for (int i = 0; i < n; ++i) {
-            int64 ai = a[i];
-            int64 di = finalCnt[i];
+    // ---- binary search for the threshold cost “lim” ----
+    int64 lo = 1 - k;              // smallest possible marginal cost (when j = 1)
+    int64 hi = 1;                  // grow until enough tickets are available
+    while (count_leq(hi) < totalCars) hi <<= 1;
+
+    while (lo < hi) {
+        int64 mid = lo + ((hi - lo) >> 1);
+        if (count_leq(mid) >= totalCars) hi = mid;
+        else                             lo = mid + 1;
+    }
+    int64 lim = lo;                // first cost value with ≥ totalCars tickets
+
+    // ---- decide how many cars each lane finally gets ----
+    // di for each lane, and the tickets whose cost == lim in this lane
+    auto lane = [&](int i, int64 &di, int &eq) {
+        int64 ai   = a[i];
+        int64 cnt1 = 0, cnt2 = 0;
+
+        if (lim + k >= 1) cnt1 = std::min<int64>(ai, lim + k);
+        if (lim > ai)     cnt2 = lim - ai;
+        di = cnt1 + cnt2;
+
+        eq = 0;
+        int64 j1 = lim + k;            // j with cost lim in sequence‑1?
+        if (1 <= j1 && j1 <= ai) ++eq; // yes, exactly one such j
+        if (lim > ai) ++eq;            // sequence‑2 also contributes one
+    };
+
+    // The surplus cars that had cost == lim are removed from the earliest
+    // lanes, so every part first needs the cost == lim tickets before it.
+    vector<int64> partEq(64, 0);
+    int parts = parallel_parts(n, [&](int p, int from, int to) {
+        int64 s = 0, di;
+        int eq;
+        for (int i = from; i < to; ++i) { lane(i, di, eq); s += eq; }
+        partEq[p] = s;
+    });
 
+    int64 surplus = count_leq(lim) - totalCars;
+    vector<int64> partSurplus(parts);
+    for (int p = 0; p < parts; ++p) {
+        partSurplus[p] = surplus;
+        surplus -= std::min(surplus, partEq[p]);
+    }
+
+    // ---- compute total angriness ----
+    vector<i128> partAnswer(parts, 0);
+    parallel_parts(n, [&](int p, int from, int to) {
+        int64 left = partSurplus[p], di;
+        int eq;
+        i128 sum = 0;
+        for (int i = from; i < to; ++i) {
+            lane(i, di, eq);
+            int64 take = std::min<int64>(eq, left);
+            di   -= take;
+            left -= take;
+
+            int64 ai = a[i];
             if (di <= ai) {
                 // cost  = di(di+1)/2 − k·di
-                answer += i128(di) * (di + 1) / 2 - i128(k) * di;
+                sum += i128(di) * (di + 1) / 2 - i128(k) * di;
             } else {
                 // cost  = di(di+1)/2 − k·ai
-                answer += i128(di) * (di + 1) / 2 - i128(k) * ai;
+                sum += i128(di) * (di + 1) / 2 - i128(k) * ai;
             }
         }
+        partAnswer[p] = sum;
+    });
 
-        print_int128(answer);
-        cout << '\n';
-    }
+    i128 answer = i128(k) * i128(totalCars);   // constant baseline k * Σai
+    for (int p = 0; p < parts; ++p) answer += partAnswer[p];
+
+    print_int128(answer, out);
+    out += '\n';
+}
+
+
+int main() {
+    run_cases([](Reader &in) { in.skip(in.next_int() + 1); }, solve);
     return 0;
 }
@@ -1,15 +1,16 @@
 #include <iostream>
-#include <cmath>
 using namespace std;
 
-bool canBobWin(int a, int x, int y) {
-    int d1 = abs(a - x);
-    int d2 = abs(a - y);
+constexpr int dist(int p, int q) { return p > q ? p - q : q - p; }
+
+constexpr bool canBobWin(int a, int x, int y) {
+    int d1 = dist(a, x);
+    int d2 = dist(a, y);
 
     for (int b = 1; b <= 100; b++) {
         if (b == a) continue;
-        int dbx = abs(b - x);
-        int dby = abs(b - y);
+        int dbx = dist(b, x);
+        int dby = dist(b, y);
         if (dbx < d1 && dby < d2) {
             return true;
         }
@@ -17,13 +18,101 @@ bool canBobWin(int a, int x, int y) {
     return false;
 }
 
+// Bits for c in [1, C]
+template <int C>
+struct BitRow {
+    static constexpr int W = (C + 63) / 64;
+    unsigned long long w[W] = {};
+
+    // set c in [lo, hi]
+    constexpr void set_range(int lo, int hi) {
+        for (int c = lo - 1; c < hi;) {
+            int word = c >> 6, from = c & 63;
+            int to = hi - 1 - word * 64 < 63 ? hi - 1 - word * 64 : 63;
+            w[word] |= (~0ULL >> (63 - (to - from))) << from;
+            c = (word + 1) * 64;
+        }
+    }
+};
+
+// Answers of a predicate over [1, A] x [1, B] x [1, C], one bit each, filled
+// in by the compiler. The filler gives a whole BitRow<C> per (a, b): a
+// predicate evaluated 10^6 times one by one does not fit in GCC's default
+// constexpr budget (-fconstexpr-ops-limit), but 10^4 row computations do.
+// Reusable for any small-domain predicate whose rows can be built directly.
+template <int A, int B, int C>
+struct BitTable3 {
+    static constexpr int N = (A * B * C + 63) / 64;
+    unsigned long long w[N] = {};
+
+    static constexpr int index(int a, int b, int c) { return ((a - 1) * B + (b - 1)) * C + (c - 1); }
+
+    template <class RowFn>
+    constexpr BitTable3(RowFn row) {
+        for (int a = 1; a <= A; a++)
+            for (int b = 1; b <= B; b++) {
+                BitRow<C> r = row(a, b);
+                int base = index(a, b, 1);
+                for (int k = 0; k < BitRow<C>::W; k++) {
+                    int off = base + 64 * k, at = off >> 6, sh = off & 63;
+                    w[at] |= r.w[k] << sh;
+                    if (sh && at + 1 < N) w[at + 1] |= r.w[k] >> (64 - sh);
+                }
+            }
+    }
+
+    constexpr bool operator()(int a, int b, int c) const {
+        int i = index(a, b, c);
+        return w[i >> 6] >> (i & 63) & 1;
+    }
+};
+
+// All y for which canBobWin(a, x, y) holds. If a is strictly between x and y,
+// getting closer to one of them means moving away from the other. Otherwise
+// b = a + 1 (a below both) or b = a - 1 (a above both) is closer to both.
+// So with a < x every y > a wins, with a > x every y < a, and a == x never.
+constexpr BitRow<100> bobRow(int a, int x) {
+    BitRow<100> r;
+    if (a < x) r.set_range(a + 1, 100);
+    if (a > x) r.set_range(1, a - 1);
+    return r;
+}
+
+// a, x, y are all in [1, 100]: 10^6 bits, 125 KB
+constexpr BitTable3<100, 100, 100> bobWins(bobRow);
+
+// The table has to agree with the brute force. A whole plane per check is
+// as much as one constant expression can afford; g++ -DSELF_CHECK runs
+// the full comparison at startup.
+constexpr bool matchesOnPlane(int y) {
+    for (int a = 1; a <= 100; a++)
+        for (int x = 1; x <= 100; x++)
+            if (bobWins(a, x, y) != canBobWin(a, x, y)) return false;
+    return true;
+}
+static_assert(matchesOnPlane(1), "bobWins table does not match canBobWin");
+static_assert(matchesOnPlane(64), "bobWins table does not match canBobWin");
+static_assert(matchesOnPlane(100), "bobWins table does not match canBobWin");
+
 int main() {
+#ifdef SELF_CHECK
+    for (int a = 1; a <= 100; a++)
+        for (int x = 1; x <= 100; x++)
+            for (int y = 1; y <= 100; y++)
+                if (bobWins(a, x, y) != canBobWin(a, x, y)) {
+                    cout << "mismatch at " << a << " " << x << " " << y << "\n";
+                    return 1;
+                }
+    cout << "table ok\n";
+    return 0;
+#endif
+
     int t;
     cin >> t;
     while (t--) {
         int a, x, y;
         cin >> a >> x >> y;
-        if (canBobWin(a, x, y)) {
+        if (bobWins(a, x, y)) {
             cout << "YES\n";
         } else {
             cout << "NO\n";
@@ -1,6 +1,47 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Triples i < j < k of the sorted array with a[i] + a[j] > a[k].
+// For a fixed i the sum a[i] + a[j] only grows with j, so the first k with
+// a[k] >= a[i] + a[j] only moves right: one sweep per i, O(n^2) in total.
+// The work for i shrinks as i grows, so threads take small blocks of i
+// from a shared counter instead of one fixed range each.
+long long count_triangles(const vector<long long> &a) {
+    int n = a.size();
+    const int BLOCK = 16;
+    atomic<int> next_i(0);
+    auto worker = [&]() {
+        long long local = 0;
+        for (;;) {
+            int from = next_i.fetch_add(BLOCK);
+            if (from >= n) break;
+            int to = min(n, from + BLOCK);
+            for (int i = from; i < to; ++i) {
+                int k = i + 2;
+                for (int j = i + 1; j < n; ++j) {
+                    long long sum2 = a[i] + a[j];
+                    k = max(k, j + 1);
+                    while (k < n && a[k] < sum2) ++k;
+                    if (k == n) {
+                        // every later j also reaches the end: add n-j-1, n-j-2, ..., 0
+                        local += (long long)(n - j - 1) * (n - j) / 2;
+                        break;
+                    }
+                    local += k - j - 1;
+                }
+            }
+        }
+        return local;
+    };
+
+    int threads = (long long)n * n >= (1 << 22) ? max(1u, thread::hardware_concurrency()) : 1;
+    vector<future<long long>> parts;
+    for (int t = 1; t < threads; ++t) parts.push_back(async(launch::async, worker));
+    long long answer = worker();
+    for (auto &p : parts) answer += p.get();
+    return answer;
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -11,31 +52,9 @@ int main() {
         int n;
         cin >> n;
         vector<long long> a(n);
-        for (auto &v : a) cin >> v;
+        for (auto &v : a) cin >> v;   // sorted non-decreasing
 
-        long long mx = a.back();         // because the array is sorted non-decreasing
-        long long answer = 0;
-
-        // Two-loop + binary-search counting (O(n² log n))
-        for (int i = 0; i < n; ++i) {
-            for (int j = i + 1; j < n; ++j) {
-                long long sum2 = a[i] + a[j];
-
-                // Find first k > j such that sum2 + a[k] > 2 * a[k]
-                long long lo = j + 1, hi = n - 1, pos = n;
-                while (lo <= hi) {
-                    long long mid = (lo + hi) / 2;
-                    if (sum2 + a[mid] > 2 * a[mid]) {
-                        pos = mid;
-                        hi = mid - 1;
-                    } else {
-                        lo = mid + 1;
-                    }
-                }
-                answer += n - pos;
-            }
-        }
-        cout << answer << '\n';
+        cout << count_triangles(a) << '\n';
     }
     return 0;
 }
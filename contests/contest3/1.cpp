@@ -1,30 +1,65 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Batch I/O: the whole input is read at once, every query field goes into
+// its own array, the formula runs over whole vectors of queries, and the
+// answers go out in a single fwrite.
+static vector<char> in_buf;
+static size_t in_pos;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+typedef int i32x16 __attribute__((vector_size(64)));
+
 int main() {
-    ios::sync_with_stdio(0);
-    cin.tie(nullptr);
-
-    int t;
-    cin >> t;
-    while (t--) {
-        int n;
-        cin >> n;
-
-        int c0 = 0, c1 = 0, c2 = 0, c3 = 0;
-        for (int i = 0; i < n; i++) {
-            int r = i % 4;
-            if (r == 0) c0++;
-            else if (r == 1) c1++;
-            else if (r == 2) c2++;
-            else c3++;
-        }
+    read_all();
+    int t = read_int();
+    int padded = (t + 15) / 16 * 16;
+    vector<int> n(padded), alice(padded);
+    for (int i = 0; i < t; i++) n[i] = read_int();
 
-        int pairs = min(c0, c3) + min(c1, c2);
+    // Indices 0..n-1 split into residues mod 4 with c0 >= c1 >= c2 >= c3,
+    // so pairs = min(c0, c3) + min(c1, c2) = c3 + c2 = 2 * (n / 4) + (n % 4 == 3).
+    // Only its parity matters: Alice wins exactly when n % 4 == 3.
+    for (int i = 0; i < padded; i += 16) {
+        i32x16 x;
+        memcpy(&x, &n[i], sizeof x);
+        i32x16 r = ((x & 3) == 3) & (x > 0);
+        memcpy(&alice[i], &r, sizeof r);
+    }
 
-        if (pairs % 2 == 1) cout << "Alice\n";
-        else cout << "Bob\n";
+    vector<char> out((size_t)t * 6 + 1);
+    char *p = out.data();
+    for (int i = 0; i < t; i++) {
+        if (alice[i]) {
+            memcpy(p, "Alice\n", 6);
+            p += 6;
+        } else {
+            memcpy(p, "Bob\n", 4);
+            p += 4;
+        }
     }
+    fwrite(out.data(), 1, p - out.data(), stdout);
 
     return 0;
 }
@@ -1,10 +1,79 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Order statistics over a fixed set of keys: a Fenwick tree of counts over
+// the sorted distinct keys. Rank, k-th largest (binary lifting descent),
+// insert and erase are O(log n). build() reuses the buffers, so building
+// again for the next array does not allocate once capacity is reached.
+struct OrderStatistics {
+    vector<int> keys; // sorted distinct keys
+    vector<int> tree; // 1-based Fenwick tree of counts
+    int m = 0, total = 0;
+
+    // Keys are the values of a. With distinct, every key counts once.
+    void build(const vector<int> &a, bool distinct) {
+        keys.assign(a.begin(), a.end());
+        sort(keys.begin(), keys.end());
+        tree.assign(keys.size() + 1, 0);
+        m = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (m == 0 || keys[i] != keys[m - 1]) keys[m++] = keys[i];
+            if (!distinct || tree[m] == 0) tree[m]++;
+        }
+        keys.resize(m);
+        tree.resize(m + 1);
+        total = 0;
+        for (int i = 1; i <= m; i++) total += tree[i];
+        for (int i = 1; i <= m; i++) {
+            int j = i + (i & -i);
+            if (j <= m) tree[j] += tree[i];
+        }
+    }
+
+    int index(int v) const { return lower_bound(keys.begin(), keys.end(), v) - keys.begin(); }
+
+    // v has to be one of the keys
+    void insert(int v, int c = 1) {
+        total += c;
+        for (int i = index(v) + 1; i <= m; i += i & -i) tree[i] += c;
+    }
+    void erase(int v) { insert(v, -1); }
+
+    // how many are < v
+    int count_less(int v) const {
+        int s = 0;
+        for (int i = index(v); i > 0; i -= i & -i) s += tree[i];
+        return s;
+    }
+
+    // how many are > v
+    int count_greater(int v) const {
+        int le = 0;
+        for (int i = upper_bound(keys.begin(), keys.end(), v) - keys.begin(); i > 0; i -= i & -i) le += tree[i];
+        return total - le;
+    }
+
+    // k-th largest, 1-based, k <= total
+    int kth_largest(int k) const {
+        k = total - k + 1; // as k-th smallest
+        int pos = 0;
+        for (int pw = m ? 1 << __lg(m) : 0; pw; pw >>= 1) {
+            if (pos + pw <= m && tree[pos + pw] < k) {
+                pos += pw;
+                k -= tree[pos];
+            }
+        }
+        return keys[pos];
+    }
+};
+
 int main() {
     ios::sync_with_stdio(0);
     cin.tie(nullptr);
 
+    OrderStatistics ranks;
+    vector<int> a;
+
     int q;
     cin >> q;
     while (q--) {
@@ -12,7 +81,7 @@ int main() {
         cin >> n >> j >> k;
 
         int value = 0;
-        vector<int> a(n);
+        a.resize(n);
         for (int i = 0; i < n; i++) {
             cin >> a[i];
             if (j - 1 == i) {
@@ -20,14 +89,9 @@ int main() {
             }
         }
 
-        set<int, greater<int>> s(a.begin(), a.end());
-        int rem = 0;
-        for (auto it = s.begin(); it != s.end(); ++it) {
-            rem++;
-            if (*it == value) {
-                break;
-            }
-        }
+        // rank of value among the distinct values, largest first
+        ranks.build(a, true);
+        int rem = ranks.count_greater(value) + 1;
 
         if (rem == 1) {
             cout << "YES\n";
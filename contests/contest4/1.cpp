@@ -1,10 +1,89 @@
 #include <iostream>
-#include <queue>
-#include <vector>
+#include <unordered_map>
 #include <climits>
 using namespace std;
 
+// Shortest paths over the states 0..N-1 with the moves v -> v + 1 (cost x)
+// and v -> v ^ 1 (cost y), both costs non-negative.
+// There are only two edge weights, so Dijkstra needs no heap: every edge of
+// one kind goes into its own FIFO, and since nodes are settled in order of
+// distance, each FIFO stays sorted. The next node is the smaller of the two
+// fronts. Every node is settled once and pushes at most one entry per FIFO.
+// The buffers live across runs; an epoch stamp says which entries are from
+// the current run, so nothing is cleared or reallocated between test cases.
+struct TwoCostPaths {
+    static constexpr int N = 200;
+
+    long long dist[N];
+    unsigned seen[N] = {}, done[N] = {}, epoch = 0;
+
+    struct Fifo {
+        int node[N + 1];
+        long long d[N + 1];
+        int head, tail;
+        bool empty() const { return head == tail; }
+        void push(int v, long long dv) { node[tail] = v, d[tail++] = dv; }
+    } by_x, by_y;
+
+    void next_epoch() {
+        if (++epoch == 0) {
+            // wrapped around, old stamps could match again
+            for (int v = 0; v < N; v++) seen[v] = done[v] = 0;
+            epoch = 1;
+        }
+    }
+
+    bool relax(int v, long long dv) {
+        if (v >= N || (seen[v] == epoch && dist[v] <= dv)) return false;
+        seen[v] = epoch;
+        dist[v] = dv;
+        return true;
+    }
+
+    // cost from a to b, -1 if b can't be reached
+    long long run(int a, int b, long long x, long long y) {
+        next_epoch();
+        by_x.head = by_x.tail = by_y.head = by_y.tail = 0;
+        relax(a, 0);
+        by_x.push(a, 0);
+
+        while (!by_x.empty() || !by_y.empty()) {
+            Fifo &f = by_y.empty() || (!by_x.empty() && by_x.d[by_x.head] <= by_y.d[by_y.head]) ? by_x : by_y;
+            int v = f.node[f.head];
+            long long dv = f.d[f.head++];
+            if (done[v] == epoch) continue;
+            done[v] = epoch;
+            if (v == b) return dv;
+
+            if (relax(v + 1, dv + x)) by_x.push(v + 1, dv + x);
+            if (relax(v ^ 1, dv + y)) by_y.push(v ^ 1, dv + y);
+        }
+        return -1;
+    }
+};
+
+struct QueryKey {
+    int a, b;
+    long long x, y;
+    bool operator==(const QueryKey &o) const { return a == o.a && b == o.b && x == o.x && y == o.y; }
+};
+
+struct QueryKeyHash {
+    size_t operator()(const QueryKey &k) const {
+        unsigned long long h = (unsigned long long)k.a << 8 | k.b;
+        h = h * 0x9E3779B97F4A7C15ULL ^ (unsigned long long)k.x;
+        h = h * 0x9E3779B97F4A7C15ULL ^ (unsigned long long)k.y;
+        return h ^ h >> 29;
+    }
+};
+
 int main() {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    static TwoCostPaths paths;
+    unordered_map<QueryKey, long long, QueryKeyHash> memo;
+
     int t;
     cin >> t;
     while (t--) {
@@ -17,34 +96,11 @@ int main() {
             continue;
         }
 
-        // BFS for shortest cost path since a, b <= 100
-        vector<long long> cost(200, LLONG_MAX);
-        cost[a] = 0;
-
-        queue<int> q;
-        q.push(a);
-
-        while (!q.empty()) {
-            int cur = q.front(); q.pop();
-
-            // Try a + 1
-            if (cur + 1 < 200 && cost[cur + 1] > cost[cur] + x) {
-                cost[cur + 1] = cost[cur] + x;
-                q.push(cur + 1);
-            }
-
-            // Try a ^ 1
-            int xor_val = cur ^ 1;
-            if (xor_val < 200 && cost[xor_val] > cost[cur] + y) {
-                cost[xor_val] = cost[cur] + y;
-                q.push(xor_val);
-            }
-        }
-
-        if (cost[b] == LLONG_MAX)
-            cout << -1 << '\n';
-        else
-            cout << cost[b] << '\n';
+        // a, b <= 100, so states up to 200 are plenty
+        QueryKey key{a, b, x, y};
+        auto it = memo.find(key);
+        if (it == memo.end()) it = memo.emplace(key, paths.run(a, b, x, y)).first;
+        cout << it->second << '\n';
     }
 
     return 0;
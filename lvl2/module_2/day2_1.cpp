@@ -1,42 +1,170 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-
-    int q;
-    cin >> q;
-    while (q--) {
-        int n;
-        cin >> n;
-        vector<int> a(n);
-        for (int i = 0; i < n; ++i) {
-           cin >> a[i];
-        }
+// Whole input in one buffer
+static vector<char> in_buf;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+}
+
+// Integers from some point of in_buf on
+struct Reader {
+    const char *p;
+
+    long long next_int() {
+        while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+        bool neg = *p == '-';
+        if (neg) ++p;
+        long long x = 0;
+        while (*p >= '0' && *p <= '9') x = x * 10 + (*p++ - '0');
+        return neg ? -x : x;
+    }
 
-        // make frequency array of a
-        vector<int> freq(1024, 0);
-        for (int i = 0; i < n; ++i) {
-            freq[a[i]]++;
+    // pass over k integers without converting them
+    void skip(long long k) {
+        while (k-- > 0) {
+            while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+            if (*p == '-') ++p;
+            while (*p >= '0' && *p <= '9') ++p;
         }
+    }
+};
 
-        // finding k
-        // initially set it to -1
-        // Also make temp freq array to compare
-        int k = -1;
-        for (int i = 1; i < 1024; ++i) {
-            vector<int> temp_freq(1024, 0);
-            for (int j = 0; j < n; ++j) {
-                temp_freq[a[j]^i]++;
-            }
-            if  (temp_freq == freq) {
-                k = i;
-                break;
+// Multi-test runner. The cases don't depend on each other, so they are
+// solved in parallel: skip_case(in) walks over one case without solving it,
+// which cuts the input into one span per case. Every thread starts with a
+// run of cases holding about the same number of input bytes, takes them from
+// the front, and when it runs dry steals the back half of another thread's
+// run. One huge case keeps its thread busy while the others drain the small
+// cases queued behind it. solve(r, out) appends a case's answer to its
+// thread's buffer, and the buffers are written out in input order.
+template <class Skip, class Solve>
+void run_cases(Skip skip_case, Solve solve) {
+    read_all();
+    Reader in{in_buf.data()};
+    int T = in.next_int();
+    vector<const char *> start(T + 1);
+    for (int c = 0; c < T; c++) {
+        start[c] = in.p;
+        skip_case(in);
+    }
+    start[T] = in.p;
+
+    int threads = max(1, min<int>(thread::hardware_concurrency(), T));
+
+    // cases [lo, hi) still to do, the owner takes lo, thieves take the back half
+    struct Range {
+        mutex m;
+        int lo = 0, hi = 0;
+    };
+    vector<Range> ranges(threads);
+    size_t bytes = start[T] - start[0];
+    for (int t = 0, c = 0; t < threads; t++) {
+        size_t goal = bytes * (t + 1) / threads;
+        ranges[t].lo = c;
+        while (c < T && (size_t)(start[c + 1] - start[0]) <= goal) c++;
+        if (t == threads - 1) c = T;
+        ranges[t].hi = c;
+    }
+
+    auto take = [&](int t, int &c) {
+        lock_guard<mutex> g(ranges[t].m);
+        if (ranges[t].lo == ranges[t].hi) return false;
+        c = ranges[t].lo++;
+        return true;
+    };
+    auto steal = [&](int t) {
+        for (int k = 1; k < threads; k++) {
+            Range &victim = ranges[(t + k) % threads];
+            int lo, hi;
+            {
+                lock_guard<mutex> g(victim.m);
+                if (victim.lo == victim.hi) continue;
+                hi = victim.hi;
+                lo = hi - (hi - victim.lo + 1) / 2;
+                victim.hi = lo;
             }
+            lock_guard<mutex> g(ranges[t].m);
+            ranges[t].lo = lo, ranges[t].hi = hi;
+            return true;
         }
+        return false;
+    };
 
-        cout << k << '\n';
+    // answer of case c is out[piece[c].t] from piece[c].from to piece[c].to
+    struct Piece {
+        int t;
+        size_t from, to;
+    };
+    vector<string> out(threads);
+    vector<Piece> piece(T);
+    auto worker = [&](int t) {
+        int c;
+        do {
+            while (take(t, c)) {
+                Reader r{start[c]};
+                size_t from = out[t].size();
+                solve(r, out[t]);
+                piece[c] = {t, from, out[t].size()};
+            }
+        } while (steal(t));
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto &th : pool) th.join();
+
+    size_t total = 0;
+    for (auto &s : out) total += s.size();
+    string all;
+    all.reserve(total);
+    for (int c = 0; c < T; c++) all.append(out[piece[c].t], piece[c].from, piece[c].to - piece[c].from);
+    fwrite(all.data(), 1, all.size(), stdout);
+}
+
+// One case: n, then a
+void solve(Reader &in, string &out) {
+    int n = in.next_int();
+    vector<int> a(n);
+    for (int i = 0; i < n; ++i) {
+       a[i] = in.next_int();
     }
+
+    // make frequency array of a
+    vector<int> freq(1024, 0);
+    for (int i = 0; i < n; ++i) {
+        freq[a[i]]++;
+    }
+
+    // finding k
+    // initially set it to -1
+    // Also make temp freq array to compare
+    int k = -1;
+    for (int i = 1; i < 1024; ++i) {
+        vector<int> temp_freq(1024, 0);
+        for (int j = 0; j < n; ++j) {
+            temp_freq[a[j]^i]++;
+        }
+        if  (temp_freq == freq) {
+            k = i;
+            break;
+        }
+    }
+
+    out += to_string(k);
+    out += '\n';
+}
+
+int main() {
+    run_cases([](Reader &in) { in.skip(in.next_int()); }, solve);
     return 0;
-}
\ No newline at end of file
+}
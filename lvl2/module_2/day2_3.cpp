@@ -1,23 +1,85 @@
 #include <bits/stdc++.h>
 using namespace std;
+
+// Batch I/O: the whole input is read at once, every query field goes into
+// its own array, the formula runs over whole vectors of queries, and the
+// answers go out in a single fwrite.
+static vector<char> in_buf;
+static size_t in_pos;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+char *write_int(char *p, long long x) {
+    if (x < 0) {
+        *p++ = '-';
+        x = -x;
+    }
+    char tmp[20];
+    int len = 0;
+    do {
+        tmp[len++] = '0' + x % 10;
+        x /= 10;
+    } while (x);
+    while (len) *p++ = tmp[--len];
+    return p;
+}
+
+typedef int i32x16 __attribute__((vector_size(64)));
+
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-
-    int t;
-    cin >> t;
-    while (t--) {
-        int n;
-        cin >>n;
-        int ans = 0;
-        int currPos = 1;
-        while (currPos <= n) {
-            int nxt = min(n, (currPos * 2)-1);
-            ans = max(ans, nxt - currPos + 1);
-            currPos *= 2;
-        }
-        cout << ans << '\n';
+    read_all();
+    int t = read_int();
+    int padded = (t + 15) / 16 * 16;
+    vector<int> n(padded), ans(padded);
+    for (int i = 0; i < t; i++) n[i] = read_int();
+
+    // Blocks are [p, 2p - 1] for p = 1, 2, 4, ... clipped at n. Every full
+    // block is longer than the ones before it, so only the last full block
+    // (length p / 2) and the clipped one (n - p + 1) can be the biggest,
+    // where p is the highest power of two <= n.
+    for (int i = 0; i < padded; i += 16) {
+        i32x16 x, p;
+        memcpy(&x, &n[i], sizeof x);
+        p = x;
+        p |= p >> 1;
+        p |= p >> 2;
+        p |= p >> 4;
+        p |= p >> 8;
+        p |= p >> 16;
+        p -= p >> 1;
+        i32x16 tail = x - p + 1, full = p >> 1;
+        i32x16 r = ((tail > full) & tail) | ((tail <= full) & full);
+        r &= x > 0;
+        memcpy(&ans[i], &r, sizeof r);
+    }
+
+    vector<char> out((size_t)t * 12 + 1);
+    char *p = out.data();
+    for (int i = 0; i < t; i++) {
+        p = write_int(p, ans[i]);
+        *p++ = '\n';
     }
+    fwrite(out.data(), 1, p - out.data(), stdout);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -4,30 +4,63 @@ using namespace std;
 void solve() {
     int n;
     cin >> n;
-    vector<int> a(n), used(n, 0), ans;
+    vector<int> a(n);
     for (int i = 0; i < n; ++i) cin >> a[i];
 
+    // cur_or | a[i] is biggest when a[i] & ~cur_or is biggest, so the OR can
+    // only improve once per bit (at most 31 picks).
+    // bucket[b] holds the indices whose highest bit missing from cur_or was b
+    // when they were put there. Buckets of bits that got covered later are
+    // stale and get pushed down only when we reach them.
+    vector<vector<int>> bucket(31);
+    for (int i = 0; i < n; ++i)
+        if (a[i] > 0) bucket[__lg(a[i])].push_back(i);
+
     int cur_or = 0;
+    vector<int> picked;
+    vector<int> stale;
+    for (int b = 30; b >= 0; --b) {
+        if (bucket[b].empty()) continue;
+
+        if (cur_or >> b & 1) {
+            // bit b is already covered, move everyone to their new highest missing bit
+            stale.swap(bucket[b]);
+            for (int i : stale) {
+                int rest = a[i] & ~cur_or;
+                if (rest) bucket[__lg(rest)].push_back(i);
+            }
+            stale.clear();
+            continue;
+        }
 
-    for (int step = 0; step < n; ++step) {
-        int best = -1, best_val = cur_or;
-        for (int i = 0; i < n; ++i) {
-            if (used[i]) continue;
-            int new_or = cur_or | a[i];
-            if (new_or > best_val) {
-                best_val = new_or;
+        // Only elements in bucket[b] can add bit b, and any of them beats
+        // every element without it. Ties go to the smaller index.
+        int best = -1, best_val = 0;
+        for (int i : bucket[b]) {
+            int val = a[i] & ~cur_or;
+            if (val > best_val || (val == best_val && i < best)) {
+                best_val = val;
                 best = i;
             }
         }
-        if (best == -1) break; // no improvement
-        ans.push_back(a[best]);
-        used[best] = 1;
-        cur_or = best_val;
+        picked.push_back(best);
+        cur_or |= a[best];
+        ++b; // revisit b, it is stale now
     }
 
-    // Add remaining unused elements in any order
-    for (int i = 0; i < n; ++i)
-        if (!used[i]) ans.push_back(a[i]);
+    // Picked elements first, then the rest in their original order.
+    // The gaps between picked indices are copied in bulk.
+    vector<int> ans(n);
+    for (int k = 0; k < (int)picked.size(); ++k) ans[k] = a[picked[k]];
+
+    sort(picked.begin(), picked.end());
+    int out = picked.size(), from = 0;
+    for (int p : picked) {
+        copy(a.begin() + from, a.begin() + p, ans.begin() + out);
+        out += p - from;
+        from = p + 1;
+    }
+    copy(a.begin() + from, a.end(), ans.begin() + out);
 
     // Print result
     for (int num : ans) cout << num << " ";
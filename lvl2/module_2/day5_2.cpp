@@ -1,6 +1,65 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Vertical (positional) popcount: cnt[b] = how many a[i] have bit b set.
+// 16 vectors of 8 ints go through a carry-save adder tree, so every bit
+// position keeps its count in binary across ones/twos/fours/eights and only
+// the sixteens need to be spread out into per-bit lane counters.
+typedef unsigned u32x8 __attribute__((vector_size(32)));
+
+static inline void csa(u32x8 &h, u32x8 &l, const u32x8 &a, const u32x8 &b, const u32x8 &c) {
+    u32x8 u = a ^ b;
+    h = (a & b) | (u & c);
+    l = u ^ c;
+}
+
+array<long long, 32> bit_counts(const int *a, size_t n) {
+    array<long long, 32> cnt{};
+    const unsigned *p = (const unsigned *)a;
+    size_t i = 0;
+
+    u32x8 ones{}, twos{}, fours{}, eights{}, sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+    u32x8 v[16];
+    u32x8 acc[32] = {};
+    auto add = [&](const u32x8 &x, long long w) {
+        for (int l = 0; l < 8; ++l)
+            for (unsigned y = x[l]; y; y &= y - 1) cnt[__builtin_ctz(y)] += w;
+    };
+
+    for (; i + 128 <= n; i += 128) {
+        memcpy(v, p + i, sizeof v);
+        csa(twosA, ones, ones, v[0], v[1]);
+        csa(twosB, ones, ones, v[2], v[3]);
+        csa(foursA, twos, twos, twosA, twosB);
+        csa(twosA, ones, ones, v[4], v[5]);
+        csa(twosB, ones, ones, v[6], v[7]);
+        csa(foursB, twos, twos, twosA, twosB);
+        csa(eightsA, fours, fours, foursA, foursB);
+        csa(twosA, ones, ones, v[8], v[9]);
+        csa(twosB, ones, ones, v[10], v[11]);
+        csa(foursA, twos, twos, twosA, twosB);
+        csa(twosA, ones, ones, v[12], v[13]);
+        csa(twosB, ones, ones, v[14], v[15]);
+        csa(foursB, twos, twos, twosA, twosB);
+        csa(eightsB, fours, fours, foursA, foursB);
+        csa(sixteens, eights, eights, eightsA, eightsB);
+        for (int b = 0; b < 32; ++b) acc[b] += (sixteens >> b) & 1;
+    }
+
+    for (int b = 0; b < 32; ++b) {
+        long long s = 0;
+        for (int l = 0; l < 8; ++l) s += acc[b][l];
+        cnt[b] = 16 * s;
+    }
+    add(eights, 8);
+    add(fours, 4);
+    add(twos, 2);
+    add(ones, 1);
+    for (; i < n; ++i)
+        for (unsigned y = p[i]; y; y &= y - 1) cnt[__builtin_ctz(y)]++;
+    return cnt;
+}
+
 void solve() {
     int n;
     long long k;
@@ -10,13 +69,12 @@ void solve() {
 
     int ans = 0;
 
+    // One pass counts how many have each bit
+    array<long long, 32> have = bit_counts(a.data(), n);
+
     // Check each bit from high to low
     for (int bit = 30; bit >= 0; bit--) {
-        int cnt = 0;
-
-        for (int i = 0; i < n; i++) {
-            if (((a[i] >> bit) & 1) == 0) cnt++; // count how many DON'T have this bit
-        }
+        long long cnt = n - have[bit]; // count how many DON'T have this bit
 
         if (cnt <= k) {
             k -= cnt;
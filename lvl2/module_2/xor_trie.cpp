@@ -0,0 +1,195 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+// Binary trie over 30-bit values, kept as a multiset. Stored values must be
+// below 2^B; query arguments may be any unsigned.
+// Nodes live in one vector and point to each other with 32-bit indices.
+// Index 0 is the root, and since the root is never anyone's child,
+// child == 0 also means "no child".
+struct XorTrie {
+    static constexpr int B = 30;
+    static constexpr unsigned NONE = UINT_MAX;
+
+    struct Node {
+        unsigned ch[2];
+        unsigned cnt;  // values in this subtree
+        unsigned xr;   // xor of those values, equals the value itself when cnt == 1
+        unsigned best; // min a ^ b over pairs inside this subtree, NONE if cnt < 2
+    };
+
+    vector<Node> pool;
+    vector<unsigned> freed;
+
+    XorTrie(size_t expected_nodes = 1) {
+        pool.reserve(expected_nodes);
+        pool.push_back({{0, 0}, 0, 0, NONE});
+    }
+
+    unsigned new_node() {
+        if (!freed.empty()) {
+            unsigned v = freed.back();
+            freed.pop_back();
+            pool[v] = {{0, 0}, 0, 0, NONE};
+            return v;
+        }
+        pool.push_back({{0, 0}, 0, 0, NONE});
+        return pool.size() - 1;
+    }
+
+    unsigned size() const { return pool[0].cnt; }
+
+    // Recompute best of node v at depth d (bit B - 1 - d splits its children).
+    void pull(unsigned v, int d) {
+        Node &x = pool[v];
+        if (d == B) {
+            x.best = x.cnt >= 2 ? 0 : NONE;
+            return;
+        }
+        unsigned l = x.ch[0], r = x.ch[1];
+        unsigned lc = l ? pool[l].cnt : 0, rc = r ? pool[r].cnt : 0;
+        // Pairs inside one child never have bit B - 1 - d set, so they beat any cross pair.
+        if (lc >= 2 || rc >= 2) {
+            x.best = min(lc >= 2 ? pool[l].best : NONE, rc >= 2 ? pool[r].best : NONE);
+        } else if (lc == 1 && rc == 1) {
+            x.best = pool[l].xr ^ pool[r].xr;
+        } else {
+            x.best = NONE;
+        }
+    }
+
+    void insert(unsigned a) {
+        unsigned path[B + 1];
+        unsigned v = 0;
+        for (int d = 0; d < B; ++d) {
+            path[d] = v;
+            pool[v].cnt++;
+            pool[v].xr ^= a;
+            int b = a >> (B - 1 - d) & 1;
+            if (!pool[v].ch[b]) {
+                unsigned u = new_node(); // may reallocate, so no references across this
+                pool[v].ch[b] = u;
+            }
+            v = pool[v].ch[b];
+        }
+        path[B] = v;
+        pool[v].cnt++;
+        pool[v].xr ^= a;
+        for (int d = B; d >= 0; --d) pull(path[d], d);
+    }
+
+    unsigned count(unsigned a) const {
+        if (a >> B) return 0;
+        unsigned v = 0;
+        for (int d = 0; d < B; ++d) {
+            v = pool[v].ch[a >> (B - 1 - d) & 1];
+            if (!v) return 0;
+        }
+        return pool[v].cnt;
+    }
+
+    // Removes one copy of a, returns false if a is not present.
+    bool erase(unsigned a) {
+        if (!count(a)) return false;
+        unsigned path[B + 1];
+        unsigned v = 0;
+        int cut = -1; // first depth whose node drops to zero
+        for (int d = 0; d <= B; ++d) {
+            path[d] = v;
+            pool[v].xr ^= a;
+            if (--pool[v].cnt == 0 && cut < 0 && d > 0) cut = d;
+            if (d < B) v = pool[v].ch[a >> (B - 1 - d) & 1];
+        }
+        int top = B;
+        if (cut > 0) {
+            pool[path[cut - 1]].ch[a >> (B - cut) & 1] = 0;
+            for (int d = cut; d <= B; ++d) freed.push_back(path[d]);
+            top = cut - 1;
+        }
+        for (int d = top; d >= 0; --d) pull(path[d], d);
+        return true;
+    }
+
+    // max a[i] ^ q over the set, the set must not be empty
+    unsigned max_xor(unsigned q) const {
+        unsigned v = 0, res = 0;
+        for (int d = 0; d < B; ++d) {
+            int b = q >> (B - 1 - d) & 1;
+            unsigned want = pool[v].ch[b ^ 1];
+            if (want) {
+                res |= 1u << (B - 1 - d);
+                v = want;
+            } else {
+                v = pool[v].ch[b];
+            }
+        }
+        return res | (q >> B << B); // the stored values have no bits up there
+    }
+
+    // min a[i] ^ a[j] over i != j, NONE if fewer than two values
+    unsigned min_pair() const { return pool[0].best; }
+
+    // number of a[i] with a[i] ^ q < t
+    unsigned count_less(unsigned q, unsigned t) const {
+        // above bit B - 1 every a[i] ^ q equals q, so those bits settle it alone
+        if (q >> B != t >> B) return q >> B < t >> B ? size() : 0;
+        unsigned v = 0, res = 0;
+        for (int d = 0; d < B; ++d) {
+            int qb = q >> (B - 1 - d) & 1, tb = t >> (B - 1 - d) & 1;
+            if (tb) {
+                // every value matching q on this bit gives a ^ q a 0 where t has a 1
+                unsigned same = pool[v].ch[qb];
+                if (same) res += pool[same].cnt;
+                v = pool[v].ch[qb ^ 1];
+            } else {
+                v = pool[v].ch[qb];
+            }
+            if (!v) return res;
+        }
+        return res;
+    }
+};
+
+int main() {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    // 1 x   : insert x
+    // 2 x   : erase one copy of x
+    // 3 x   : max a[i] ^ x            (-1 if empty)
+    // 4     : min a[i] ^ a[j], i != j (-1 if fewer than two)
+    // 5 x t : count a[i] with a[i] ^ x < t
+    int q;
+    cin >> q;
+    XorTrie trie(1 << 20);
+    while (q--) {
+        int type;
+        cin >> type;
+        if (type == 1) {
+            unsigned x;
+            cin >> x;
+            if (x >> XorTrie::B) {
+                cerr << "value " << x << " does not fit in " << XorTrie::B << " bits\n";
+                return 1;
+            }
+            trie.insert(x);
+        } else if (type == 2) {
+            unsigned x;
+            cin >> x;
+            trie.erase(x);
+        } else if (type == 3) {
+            unsigned x;
+            cin >> x;
+            if (trie.size() == 0) cout << -1 << '\n';
+            else cout << trie.max_xor(x) << '\n';
+        } else if (type == 4) {
+            unsigned res = trie.min_pair();
+            if (res == XorTrie::NONE) cout << -1 << '\n';
+            else cout << res << '\n';
+        } else {
+            unsigned x, t;
+            cin >> x >> t;
+            cout << trie.count_less(x, t) << '\n';
+        }
+    }
+    return 0;
+}
@@ -1,44 +1,59 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Writes `times` copies of tok to stdout, filling one buffer once and
+// reusing it, so k can be far too big to keep the parts in memory.
+void write_repeated(const string &tok, long long times) {
+    static char buf[1 << 16];
+    long long per = sizeof(buf) / tok.size();
+    long long filled = min(per, times);
+    for (long long i = 0; i < filled; ++i) {
+        memcpy(buf + i * tok.size(), tok.data(), tok.size());
+    }
+    while (times > 0) {
+        long long now = min(per, times);
+        fwrite(buf, 1, now * tok.size(), stdout);
+        times -= now;
+    }
+}
+
 int main() {
-    int n, k;
-    cin >> n >> k;
+    long long n, k;
+    if (scanf("%lld %lld", &n, &k) != 2) return 0;
 
-    // Step 1: Decompose n into powers of 2 using binary representation
-    priority_queue<int> pq;
-    int sum = 0;
-    for (int i = 0; (1 << i) <= n; ++i) {
-        if (n & (1 << i)) {
-            pq.push(1 << i); // add the power of 2 to the heap
+    // Step 1: Decompose n into powers of 2 using binary representation,
+    // keeping how many parts there are of each exponent
+    long long cnt[63] = {};
+    long long parts = 0;
+    for (int e = 0; e < 63; ++e) {
+        if (n >> e & 1) {
+            cnt[e] = 1;
+            parts++;
         }
     }
 
     // Step 2: Check if it is even possible
-    if (k < pq.size() || k > n) {
-        cout << "NO\n";
+    if (k < parts || k > n) {
+        puts("NO");
         return 0;
     }
 
-    // Step 3: Split largest values until we have exactly k parts
-    while (pq.size() < k) {
-        int top = pq.top();
-        pq.pop();
-        // Split top into two halves
-        pq.push(top / 2);
-        pq.push(top / 2);
+    // Step 3: Split largest values until we have exactly k parts.
+    // Splitting s parts of 2^e gives 2s parts of 2^(e-1) and one more part each,
+    // so whole exponents are done at once instead of one pop at a time.
+    for (int e = 62; e > 0 && parts < k; --e) {
+        long long s = min(cnt[e], k - parts);
+        cnt[e] -= s;
+        cnt[e - 1] += 2 * s;
+        parts += s;
     }
 
-    // Step 4: Output the result
-    cout << "YES\n";
-    vector<int> result;
-    while (!pq.empty()) {
-        result.push_back(pq.top());
-        pq.pop();
+    // Step 4: Output the result, largest first
+    puts("YES");
+    for (int e = 62; e >= 0; --e) {
+        if (cnt[e] > 0) write_repeated(to_string(1LL << e) + " ", cnt[e]);
     }
-
-    for (int x : result) cout << x << " ";
-    cout << endl;
+    puts("");
 
     return 0;
 }
@@ -1,18 +1,81 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Batch I/O: the whole input is read at once, every query field goes into
+// its own array, the formula runs over whole vectors of queries, and the
+// answers go out in a single fwrite.
+static vector<char> in_buf;
+static size_t in_pos;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+char *write_int(char *p, long long x) {
+    if (x < 0) {
+        *p++ = '-';
+        x = -x;
+    }
+    char tmp[20];
+    int len = 0;
+    do {
+        tmp[len++] = '0' + x % 10;
+        x /= 10;
+    } while (x);
+    while (len) *p++ = tmp[--len];
+    return p;
+}
+
+typedef long long i64x8 __attribute__((vector_size(64)));
+
 int main () {
-    int tt; 
-    cin >> tt;
-    while (tt--) {
-        long long n;
-        cin >> n;
-        long long ans = 0;
-        while (n > 0) {
-            ans += n;
-            n /= 2;
-        }
-        cout << ans << endl;
+    read_all();
+    int tt = read_int();
+    int padded = (tt + 7) / 8 * 8;
+    vector<long long> n(padded), ans(padded);
+    for (int i = 0; i < tt; i++) n[i] = read_int();
+
+    // n + n/2 + n/4 + ... = 2n - popcount(n): every set bit 2^b adds
+    // 2^b + 2^(b-1) + ... + 1 = 2^(b+1) - 1.
+    // Non-positive n gives 0, like the original loop that never runs.
+    for (int i = 0; i < padded; i += 8) {
+        i64x8 x, c;
+        memcpy(&x, &n[i], sizeof x);
+        c = x - ((x >> 1) & 0x5555555555555555LL);
+        c = (c & 0x3333333333333333LL) + ((c >> 2) & 0x3333333333333333LL);
+        c = (c + (c >> 4)) & 0x0f0f0f0f0f0f0f0fLL;
+        c += c >> 8;
+        c += c >> 16;
+        c += c >> 32;
+        c &= 0x7f;
+        i64x8 r = (2 * x - c) & (x > 0);
+        memcpy(&ans[i], &r, sizeof r);
+    }
+
+    vector<char> out((size_t)tt * 21 + 1);
+    char *p = out.data();
+    for (int i = 0; i < tt; i++) {
+        p = write_int(p, ans[i]);
+        *p++ = '\n';
     }
+    fwrite(out.data(), 1, p - out.data(), stdout);
     return 0;
-}
\ No newline at end of file
+}
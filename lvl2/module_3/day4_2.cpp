@@ -1,6 +1,203 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Vertical (positional) popcount: cnt[b] = how many a[i] have bit b set.
+// 16 vectors of 8 ints go through a carry-save adder tree, so every bit
+// position keeps its count in binary across ones/twos/fours/eights and only
+// the sixteens need to be spread out into per-bit lane counters.
+typedef unsigned u32x8 __attribute__((vector_size(32)));
+
+static inline void csa(u32x8 &h, u32x8 &l, const u32x8 &a, const u32x8 &b, const u32x8 &c) {
+    u32x8 u = a ^ b;
+    h = (a & b) | (u & c);
+    l = u ^ c;
+}
+
+array<long long, 32> bit_counts(const int *a, size_t n) {
+    array<long long, 32> cnt{};
+    const unsigned *p = (const unsigned *)a;
+    size_t i = 0;
+
+    u32x8 ones{}, twos{}, fours{}, eights{}, sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+    u32x8 v[16];
+    u32x8 acc[32] = {};
+    auto add = [&](const u32x8 &x, long long w) {
+        for (int l = 0; l < 8; ++l)
+            for (unsigned y = x[l]; y; y &= y - 1) cnt[__builtin_ctz(y)] += w;
+    };
+
+    for (; i + 128 <= n; i += 128) {
+        memcpy(v, p + i, sizeof v);
+        csa(twosA, ones, ones, v[0], v[1]);
+        csa(twosB, ones, ones, v[2], v[3]);
+        csa(foursA, twos, twos, twosA, twosB);
+        csa(twosA, ones, ones, v[4], v[5]);
+        csa(twosB, ones, ones, v[6], v[7]);
+        csa(foursB, twos, twos, twosA, twosB);
+        csa(eightsA, fours, fours, foursA, foursB);
+        csa(twosA, ones, ones, v[8], v[9]);
+        csa(twosB, ones, ones, v[10], v[11]);
+        csa(foursA, twos, twos, twosA, twosB);
+        csa(twosA, ones, ones, v[12], v[13]);
+        csa(twosB, ones, ones, v[14], v[15]);
+        csa(foursB, twos, twos, twosA, twosB);
+        csa(eightsB, fours, fours, foursA, foursB);
+        csa(sixteens, eights, eights, eightsA, eightsB);
+        for (int b = 0; b < 32; ++b) acc[b] += (sixteens >> b) & 1;
+    }
+
+    for (int b = 0; b < 32; ++b) {
+        long long s = 0;
+        for (int l = 0; l < 8; ++l) s += acc[b][l];
+        cnt[b] = 16 * s;
+    }
+    add(eights, 8);
+    add(fours, 4);
+    add(twos, 2);
+    add(ones, 1);
+    for (; i < n; ++i)
+        for (unsigned y = p[i]; y; y &= y - 1) cnt[__builtin_ctz(y)]++;
+    return cnt;
+}
+
+// Smallest prime factor sieve shared by all test cases. It is only built as
+// far as the biggest g seen so far (doubling each time), up to SIEVE_MAX.
+// Larger values are factored with Pollard's rho instead.
+const int SIEVE_MAX = 1 << 24;
+vector<int> spf;
+
+void ensure_sieve(long long lim) {
+    if (lim < (long long)spf.size() || (int)spf.size() > SIEVE_MAX) return;
+    int sz = max<int>(spf.size(), 1 << 10);
+    while (sz <= lim && sz < SIEVE_MAX) sz *= 2;
+    sz = min(sz, SIEVE_MAX) + 1;
+    spf.assign(sz, 0);
+    vector<int> primes;
+    for (int i = 2; i < sz; i++) {
+        if (spf[i] == 0) {
+            spf[i] = i;
+            primes.push_back(i);
+        }
+        for (int p : primes) {
+            if (p > spf[i] || (long long)i * p >= sz) break;
+            spf[i * p] = p;
+        }
+    }
+}
+
+unsigned long long mul_mod(unsigned long long a, unsigned long long b, unsigned long long m) {
+    return (unsigned __int128)a * b % m;
+}
+
+unsigned long long pow_mod(unsigned long long a, unsigned long long e, unsigned long long m) {
+    unsigned long long r = 1;
+    for (a %= m; e; e >>= 1, a = mul_mod(a, a, m))
+        if (e & 1) r = mul_mod(r, a, m);
+    return r;
+}
+
+// Deterministic Miller-Rabin for 64-bit n
+bool is_prime(unsigned long long n) {
+    if (n < 2) return false;
+    for (unsigned long long p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+        if (n % p == 0) return n == p;
+    }
+    unsigned long long d = n - 1;
+    int s = 0;
+    while (d % 2 == 0) d /= 2, s++;
+    for (unsigned long long a : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+        unsigned long long x = pow_mod(a, d, n);
+        if (x == 1 || x == n - 1) continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++) {
+            x = mul_mod(x, x, n);
+            if (x == n - 1) composite = false;
+        }
+        if (composite) return false;
+    }
+    return true;
+}
+
+// Some non-trivial factor of an odd composite n. Brent's cycle finding: x
+// stays put while y walks r = 1, 2, 4, ... steps, and the differences are
+// multiplied together so one gcd covers a batch of M steps. If a batch
+// overshoots to gcd == n, it is walked again one step at a time.
+unsigned long long pollard_rho(unsigned long long n) {
+    const unsigned long long M = 128;
+    for (unsigned long long c = 1;; c++) {
+        auto f = [&](unsigned long long x) { return (mul_mod(x, x, n) + c) % n; };
+        unsigned long long x = 2, y = 2, ys = 2, q = 1, g = 1;
+        for (unsigned long long r = 1; g == 1; r *= 2) {
+            x = y;
+            for (unsigned long long i = 0; i < r; i++) y = f(y);
+            for (unsigned long long k = 0; k < r && g == 1; k += M) {
+                ys = y;
+                for (unsigned long long i = 0; i < min(M, r - k); i++) {
+                    y = f(y);
+                    q = mul_mod(q, x > y ? x - y : y - x, n);
+                }
+                g = __gcd(q, n);
+            }
+        }
+        if (g == n) {
+            do {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n) return g;
+    }
+}
+
+void factor_into(unsigned long long n, vector<unsigned long long> &primes) {
+    if (n == 1) return;
+    if (n < spf.size()) {
+        while (n > 1) {
+            primes.push_back(spf[n]);
+            n /= spf[n];
+        }
+        return;
+    }
+    if (n % 2 == 0) {
+        primes.push_back(2);
+        factor_into(n / 2, primes);
+        return;
+    }
+    if (is_prime(n)) {
+        primes.push_back(n);
+        return;
+    }
+    unsigned long long d = pollard_rho(n);
+    factor_into(d, primes);
+    factor_into(n / d, primes);
+}
+
+// All divisors of g in increasing order. For each prime power p^e the list
+// so far times p, p^2, ... is still sorted, so it is merged in, never sorted.
+vector<long long> sorted_divisors(long long g) {
+    ensure_sieve(g);
+    vector<unsigned long long> primes;
+    factor_into(g, primes);
+    sort(primes.begin(), primes.end()); // at most 63 of them
+
+    vector<long long> divs = {1}, scaled, merged;
+    for (size_t i = 0; i < primes.size();) {
+        unsigned long long p = primes[i];
+        int e = 0;
+        while (i < primes.size() && primes[i] == p) i++, e++;
+
+        size_t base = divs.size();
+        scaled.assign(divs.begin(), divs.end());
+        for (int k = 0; k < e; k++) {
+            for (long long &d : scaled) d *= p;
+            merged.resize(divs.size() + base);
+            merge(divs.begin(), divs.end(), scaled.begin(), scaled.end(), merged.begin());
+            divs.swap(merged);
+        }
+    }
+    return divs;
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
@@ -16,14 +213,8 @@ int main() {
         }
         
         // Count number of elements with bit j set for each bit position
-        vector<int> cnt(30, 0);
-        for (int i = 0; i < n; i++) {
-            for (int j = 0; j < 30; j++) {
-                if (a[i] & (1 << j)) {
-                    cnt[j]++;
-                }
-            }
-        }
+        array<long long, 32> all_cnt = bit_counts(a.data(), n);
+        vector<int> cnt(all_cnt.begin(), all_cnt.begin() + 30);
         
         // If all elements are 0, any k from 1 to n works
         bool all_zero = true;
@@ -49,20 +240,11 @@ int main() {
             }
         }
         
-        // Find all divisors of g
-        vector<int> ans;
-        for (int k = 1; k * k <= g; k++) {
-            if (g % k == 0) {
-                ans.push_back(k);
-                if (k != g / k) {
-                    ans.push_back(g / k);
-                }
-            }
-        }
-        sort(ans.begin(), ans.end());
+        // Find all divisors of g, already in increasing order
+        vector<long long> ans = sorted_divisors(g);
         
         // Output the result
-        for (int k : ans) {
+        for (long long k : ans) {
             cout << k << " ";
         }
         cout << "\n";
@@ -1,34 +1,85 @@
 #include <bits/stdc++.h>
 using namespace std;
 
+// Batch I/O: the whole input is read at once, every query field goes into
+// its own array, the formula runs over whole vectors of queries, and the
+// answers go out in a single fwrite.
+static vector<char> in_buf;
+static size_t in_pos;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+    in_pos = 0;
+}
+
+long long read_int() {
+    const char *s = in_buf.data();
+    while (s[in_pos] && s[in_pos] != '-' && (s[in_pos] < '0' || s[in_pos] > '9')) ++in_pos;
+    bool neg = s[in_pos] == '-';
+    if (neg) ++in_pos;
+    long long x = 0;
+    while (s[in_pos] >= '0' && s[in_pos] <= '9') x = x * 10 + (s[in_pos++] - '0');
+    return neg ? -x : x;
+}
+
+char *write_int(char *p, long long x) {
+    if (x < 0) {
+        *p++ = '-';
+        x = -x;
+    }
+    char tmp[20];
+    int len = 0;
+    do {
+        tmp[len++] = '0' + x % 10;
+        x /= 10;
+    } while (x);
+    while (len) *p++ = tmp[--len];
+    return p;
+}
+
+typedef int i32x16 __attribute__((vector_size(64)));
+
 int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-    
-    int tt;
-    cin >> tt;
-    while (tt--) {
-        int a, b;
-        cin >> a >> b;
-        // Compute XOR of numbers from 0 to a-1 in O(1)
-        int sum;
-        int mod = a % 4;
-        if (mod == 0) sum = 0;
-        else if (mod == 1) sum = a - 1;
-        else if (mod == 2) sum = 1;
-        else sum = a; // mod == 3
-        
-        int x = sum ^ b; // Element needed to make XOR = b
-        if (sum == b) {
-            // Array [0, 1, ..., a-1] works
-            cout << a << endl;
-        } else if (x == a) {
-            // Adding x = a increases MEX, so use a+2
-            cout << a + 2 << endl;
-        } else {
-            // If x < a or x > a, array [0, 1, ..., a-1, x] works
-            cout << a + 1 << endl;
-        }
+    read_all();
+    int tt = read_int();
+    int padded = (tt + 15) / 16 * 16;
+    vector<int> a(padded), b(padded), ans(padded);
+    for (int i = 0; i < tt; i++) {
+        a[i] = read_int();
+        b[i] = read_int();
+    }
+
+    for (int i = 0; i < padded; i += 16) {
+        i32x16 va, vb;
+        memcpy(&va, &a[i], sizeof va);
+        memcpy(&vb, &b[i], sizeof vb);
+
+        // XOR of numbers from 0 to a-1 by a % 4: 0, a - 1, 1, a
+        // (comparisons give all-ones lanes, so & picks the matching case)
+        i32x16 mod = va & 3;
+        i32x16 sum = ((mod == 1) & (va - 1)) | ((mod == 2) & 1) | ((mod == 3) & va);
+
+        // sum == b: [0, 1, ..., a-1] works, answer a
+        // x == a:   adding x = a increases MEX, so use a+2
+        // else:     [0, 1, ..., a-1, x] works, answer a+1
+        i32x16 x = sum ^ vb;
+        i32x16 r = va + ((sum != vb) & (1 - (x == va)));
+        memcpy(&ans[i], &r, sizeof r);
+    }
+
+    vector<char> out((size_t)tt * 12 + 1);
+    char *p = out.data();
+    for (int i = 0; i < tt; i++) {
+        p = write_int(p, ans[i]);
+        *p++ = '\n';
     }
+    fwrite(out.data(), 1, p - out.data(), stdout);
     return 0;
-}
\ No newline at end of file
+}
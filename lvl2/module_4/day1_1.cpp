@@ -1,16 +1,158 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-int main() {
+// Pairs that do not fit in the memory budget are sorted externally:
+// sorted runs of at most `cap` pairs are spilled one after another into a
+// temporary file and then k-way merged with a heap, each run read back in
+// big blocks. The budget is argv[1] in MB (default 256).
+// Any failure of the temporary files (no space, unwritable temp dir, short
+// read) ends the program with an error rather than printing a wrong answer.
+
+[[noreturn]] void die(const char *what) {
+    perror(what);
+    exit(1);
+}
+
+FILE *open_temp() {
+    FILE *f = tmpfile();
+    if (!f) die("tmpfile");
+    return f;
+}
+
+void write_all(const void *p, size_t size, size_t count, FILE *f) {
+    if (fwrite(p, size, count, f) != count) die("write to temporary file");
+}
+
+void read_exact(void *p, size_t size, size_t count, FILE *f) {
+    if (fread(p, size, count, f) != count) die("read from temporary file");
+}
+
+struct RunReader {
+    FILE *f;
+    long long off, left; // where the unread part of this run starts, and its size
+    vector<pair<int, int>> buf;
+    size_t pos = 0, len = 0;
+
+    bool next(pair<int, int> &out) {
+        if (pos == len) {
+            if (left == 0) return false;
+            if (fseek(f, off, SEEK_SET) != 0) die("seek in temporary file");
+            len = min<long long>(buf.size(), left);
+            read_exact(buf.data(), sizeof(buf[0]), len, f);
+            off += len * sizeof(buf[0]);
+            left -= len;
+            pos = 0;
+        }
+        out = buf[pos++];
+        return true;
+    }
+};
+
+void sort_external(int n, size_t cap) {
+    // The input gives all firsts before all seconds, so the firsts are parked
+    // in a file until their seconds arrive.
+    FILE *firsts = open_temp();
+    vector<int> block(1 << 16);
+    for (int done = 0; done < n;) {
+        int len = min<size_t>(block.size(), n - done);
+        for (int i = 0; i < len; i++) cin >> block[i];
+        write_all(block.data(), sizeof(int), len, firsts);
+        done += len;
+    }
+    if (fflush(firsts) != 0) die("write to temporary file");
+    rewind(firsts);
+
+    // Pair them up chunk by chunk, sort each chunk and spill it as a run
+    FILE *runs = open_temp();
+    vector<int> run_len;
+    {
+        vector<pair<int, int>> chunk(min<size_t>(cap, n));
+        for (int done = 0; done < n;) {
+            int len = min<size_t>(chunk.size(), n - done);
+            for (int i = 0; i < len; i += block.size()) {
+                int got = min<size_t>(block.size(), len - i);
+                read_exact(block.data(), sizeof(int), got, firsts);
+                for (int j = 0; j < got; j++) chunk[i + j].first = block[j];
+            }
+            for (int i = 0; i < len; i++) {
+                cin >> chunk[i].second;
+            }
+            sort(chunk.begin(), chunk.begin() + len);
+            write_all(chunk.data(), sizeof(chunk[0]), len, runs);
+            run_len.push_back(len);
+            done += len;
+        }
+    }
+    fclose(firsts);
+    if (fflush(runs) != 0) die("write to temporary file");
+
+    // Split the budget between the run buffers and the buffer that holds the
+    // seconds until the firsts line is finished
+    size_t each = max<size_t>(1, cap / (run_len.size() + 1));
+    vector<RunReader> readers(run_len.size());
+    using Item = pair<pair<int, int>, int>;
+    priority_queue<Item, vector<Item>, greater<Item>> pq;
+    long long off = 0;
+    for (size_t r = 0; r < run_len.size(); r++) {
+        readers[r].f = runs;
+        readers[r].off = off;
+        readers[r].left = run_len[r];
+        readers[r].buf.resize(each);
+        off += run_len[r] * sizeof(pair<int, int>);
+        pair<int, int> p;
+        if (readers[r].next(p)) pq.push({p, (int)r});
+    }
+
+    FILE *seconds = open_temp();
+    vector<int> out(each * 2);
+    size_t used = 0;
+    while (!pq.empty()) {
+        auto [p, r] = pq.top();
+        pq.pop();
+        cout << p.first << " ";
+        out[used++] = p.second;
+        if (used == out.size()) {
+            write_all(out.data(), sizeof(int), used, seconds);
+            used = 0;
+        }
+        if (readers[r].next(p)) pq.push({p, r});
+    }
+    write_all(out.data(), sizeof(int), used, seconds);
+    if (fflush(seconds) != 0) die("write to temporary file");
+    cout << endl;
+    fclose(runs);
+
+    rewind(seconds);
+    for (int done = 0; done < n;) {
+        size_t len = min<size_t>(out.size(), n - done);
+        read_exact(out.data(), sizeof(int), len, seconds);
+        for (size_t i = 0; i < len; i++) {
+            cout << out[i] << " ";
+        }
+        done += len;
+    }
+    cout << endl;
+    fclose(seconds);
+}
+
+int main(int argc, char **argv) {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
-    
+
+    size_t budget_mb = argc > 1 ? atol(argv[1]) : 256;
+    size_t cap = max<size_t>(1, (budget_mb << 20) / sizeof(pair<int, int>));
+
     int tt;
     cin >> tt;
     while (tt--) {
         int n;
         cin >> n;
-        pair<int, int> a[n];
+        if ((size_t)n > cap) {
+            sort_external(n, cap);
+            continue;
+        }
+
+        vector<pair<int, int>> a(n);
         for (int i = 0; i < n; i++) {
             cin >> a[i].first;
         }
@@ -18,7 +160,7 @@ int main() {
             cin >> a[i].second;
         }
 
-        sort(a, a + n);
+        sort(a.begin(), a.end());
         for (int i = 0; i < n; i++) {
             cout << a[i].first << " ";
         }
@@ -30,4 +172,4 @@ int main() {
 
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,107 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+// Same greedy as day1_3 (buy the cheapest totalCost first while the budget
+// lasts), but for many budgets against one cost list. The answer for a
+// budget c is the number of prefix sums of the sorted costs that are <= c,
+// so the prefix sums are stored in Eytzinger (BFS) order and every budget
+// is one branchless, prefetching upper_bound.
+struct EytzingerCounter {
+    int n;
+    long long *t;    // t[1..n]: node k has children 2k and 2k+1
+    vector<int> pos; // pos[k]: index of t[k] in sorted order
+
+    EytzingerCounter(const vector<long long> &sorted) : n(sorted.size()), pos(n + 1) {
+        // 64-byte aligned so the 8 grandchildren-of-grandchildren of a node
+        // (t[8k..8k+7]) share one cache line
+        size_t bytes = ((n + 1) * sizeof(long long) + 63) / 64 * 64;
+        t = static_cast<long long *>(aligned_alloc(64, bytes));
+        int i = 0;
+        build(sorted, i, 1);
+    }
+    ~EytzingerCounter() { free(t); }
+    EytzingerCounter(const EytzingerCounter &) = delete;
+    EytzingerCounter &operator=(const EytzingerCounter &) = delete;
+
+    void build(const vector<long long> &sorted, int &i, int k) {
+        if (k > n) return;
+        build(sorted, i, 2 * k);
+        pos[k] = i;
+        t[k] = sorted[i++];
+        build(sorted, i, 2 * k + 1);
+    }
+
+    // how many values are <= x
+    int count_leq(long long x) const {
+        size_t k = 1;
+        while (k <= (size_t)n) {
+            __builtin_prefetch(t + k * 8);
+            k = 2 * k + (t[k] <= x);
+        }
+        // Undo the trailing right turns to land on the first value > x
+        k >>= __builtin_ctzll(~k) + 1;
+        return k == 0 ? n : pos[k];
+    }
+
+    // Batched version: B searches advance level by level in lockstep, so
+    // their cache misses overlap instead of queueing behind each other.
+    void count_leq(const long long *xs, int *out, size_t m) const {
+        if (n == 0) {
+            fill(out, out + m, 0); // nothing to buy, and __lg(0) is undefined
+            return;
+        }
+        const int B = 16;
+        int full = __lg(n); // levels 0..full-1 are complete
+        size_t done = 0;
+        for (; done + B <= m; done += B) {
+            size_t k[B];
+            for (int j = 0; j < B; j++) k[j] = 1;
+            for (int lvl = 0; lvl < full; lvl++) {
+                for (int j = 0; j < B; j++) {
+                    __builtin_prefetch(t + k[j] * 8);
+                    k[j] = 2 * k[j] + (t[k[j]] <= xs[done + j]);
+                }
+            }
+            for (int j = 0; j < B; j++) {
+                size_t kk = k[j];
+                if (kk <= (size_t)n) kk = 2 * kk + (t[kk] <= xs[done + j]);
+                kk >>= __builtin_ctzll(~kk) + 1;
+                out[done + j] = kk == 0 ? n : pos[kk];
+            }
+        }
+        for (; done < m; done++) out[done] = count_leq(xs[done]);
+    }
+};
+
+int main() {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int n, q;
+    cin >> n >> q;
+    vector<long long> totalCost(n);
+    for (int i = 0; i < n; i++) {
+        long long ai;
+        cin >> ai;
+        totalCost[i] = (i + 1) + ai;
+    }
+
+    sort(totalCost.begin(), totalCost.end());
+    for (int i = 1; i < n; i++) {
+        totalCost[i] += totalCost[i - 1];
+    }
+    EytzingerCounter prefix(totalCost);
+
+    vector<long long> c(q);
+    for (int i = 0; i < q; i++) {
+        cin >> c[i];
+    }
+    vector<int> cnt(q);
+    prefix.count_leq(c.data(), cnt.data(), q);
+
+    for (int i = 0; i < q; i++) {
+        cout << cnt[i] << '\n';
+    }
+
+    return 0;
+}
@@ -1,40 +1,152 @@
 #include <bits/stdc++.h>
+#include <immintrin.h>
 using namespace std;
 
+// Scans used below. The AVX2 versions compare 8 ints per instruction and
+// turn the result into a bitmask (cmpeq/cmpgt + movemask), so a hit is
+// found with one ctz/clz. They are compiled for AVX2 on their own and only
+// called when the CPU has it; the scalar loops handle the tails and other CPUs.
+// Nothing here reads outside [0, n).
+
+// first i with a[i] != b[i], n if none
+int first_mismatch_scalar(const int *a, const int *b, int i, int n) {
+    for (; i < n; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return n;
+}
+
+// last i with a[i] != b[i] among [0, n), -1 if none
+int last_mismatch_scalar(const int *a, const int *b, int n) {
+    for (int i = n - 1; i >= 0; i--) {
+        if (a[i] != b[i]) return i;
+    }
+    return -1;
+}
+
+// first i >= r with i == n - 1 or b[i + 1] < b[i]
+int run_end_scalar(const int *b, int r, int n) {
+    while (r < n - 1 && b[r + 1] >= b[r]) r++;
+    return r;
+}
+
+// last i <= l with i == 0 or b[i - 1] > b[i]
+int run_start_scalar(const int *b, int l) {
+    while (l > 0 && b[l - 1] <= b[l]) l--;
+    return l;
+}
+
+__attribute__((target("avx2"))) static inline unsigned eq_mask(const int *a, const int *b) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)a);
+    __m256i y = _mm256_loadu_si256((const __m256i *)b);
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, y)));
+}
+
+// bit k set when b[k] > b[k + 1], for k in [0, 8)
+__attribute__((target("avx2"))) static inline unsigned desc_mask(const int *b) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)b);
+    __m256i y = _mm256_loadu_si256((const __m256i *)(b + 1));
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, y)));
+}
+
+__attribute__((target("avx2"))) int first_mismatch_avx2(const int *a, const int *b, int n) {
+    int i = 0;
+    // 32 ints per round keeps enough loads in flight to run at memory speed
+    for (; i + 32 <= n; i += 32) {
+        unsigned m = eq_mask(a + i, b + i) & eq_mask(a + i + 8, b + i + 8) &
+                     eq_mask(a + i + 16, b + i + 16) & eq_mask(a + i + 24, b + i + 24);
+        if (m != 0xff) break;
+    }
+    for (; i + 8 <= n; i += 8) {
+        unsigned m = eq_mask(a + i, b + i);
+        if (m != 0xff) return i + __builtin_ctz(~m & 0xff);
+    }
+    return first_mismatch_scalar(a, b, i, n);
+}
+
+__attribute__((target("avx2"))) int last_mismatch_avx2(const int *a, const int *b, int n) {
+    int hi = n; // [hi, n) is known to match
+    for (; hi >= 32; hi -= 32) {
+        unsigned m = eq_mask(a + hi - 8, b + hi - 8) & eq_mask(a + hi - 16, b + hi - 16) &
+                     eq_mask(a + hi - 24, b + hi - 24) & eq_mask(a + hi - 32, b + hi - 32);
+        if (m != 0xff) break;
+    }
+    for (; hi >= 8; hi -= 8) {
+        unsigned m = ~eq_mask(a + hi - 8, b + hi - 8) & 0xff;
+        if (m) return hi - 8 + 31 - __builtin_clz(m);
+    }
+    return last_mismatch_scalar(a, b, hi);
+}
+
+__attribute__((target("avx2"))) int run_end_avx2(const int *b, int r, int n) {
+    for (; r + 9 <= n; r += 8) {
+        unsigned m = desc_mask(b + r);
+        if (m) return r + __builtin_ctz(m);
+    }
+    return run_end_scalar(b, r, n);
+}
+
+__attribute__((target("avx2"))) int run_start_avx2(const int *b, int l) {
+    // pairs (j - 1, j) for j in (l - 8, l]
+    for (; l >= 8; l -= 8) {
+        unsigned m = desc_mask(b + l - 8);
+        if (m) return l - 7 + 31 - __builtin_clz(m);
+    }
+    return run_start_scalar(b, l);
+}
+
+const bool has_avx2 = __builtin_cpu_supports("avx2");
+
+int first_mismatch(const int *a, const int *b, int n) {
+    return has_avx2 ? first_mismatch_avx2(a, b, n) : first_mismatch_scalar(a, b, 0, n);
+}
+int last_mismatch(const int *a, const int *b, int n) {
+    return has_avx2 ? last_mismatch_avx2(a, b, n) : last_mismatch_scalar(a, b, n);
+}
+// The run scans start from a position inside b: r and l are clamped to
+// [0, n - 1], and with n == 0 there is nothing to scan.
+int run_end(const int *b, int r, int n) {
+    if (n == 0) return -1;
+    r = min(max(r, 0), n - 1);
+    return has_avx2 ? run_end_avx2(b, r, n) : run_end_scalar(b, r, n);
+}
+int run_start(const int *b, int l, int n) {
+    if (n == 0) return 0;
+    l = min(max(l, 0), n - 1);
+    return has_avx2 ? run_start_avx2(b, l) : run_start_scalar(b, l);
+}
+
 int main() {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
-    int tt; 
+    int tt;
     cin >> tt;
     while (tt--) {
         int n;
         cin >> n;
         vector<int> a(n);
-        vector<int> b(n); 
+        vector<int> b(n);
         for (int i = 0; i < n; i++) {
             cin >> a[i];
         }
         for (int i = 0; i < n; i++) {
             cin >> b[i];
         }
-        int l, r;
-        for (l = 0; l < n; l++) {
-            if (b[l] != a[l]) {
-                break;
-            }
-        }
-        for (r = n - 1; r >= 0; r--) {
-            if (b[r] != a[r]) {
-                break;
+        int l = first_mismatch(a.data(), b.data(), n);
+        int r = last_mismatch(a.data(), b.data(), n);
+        if (l == n) {
+            // identical: sorting any non-decreasing run of b is a no-op,
+            // so answer the one that starts at the front
+            if (n == 0) {
+                cout << "0 0\n";
+                continue;
             }
+            l = r = 0;
         }
-        while (b[r+1] >= b[r] && r < n - 1) {
-            r++;
-        }
-        while(b[l-1] <= b[l] && l > 0) {
-            l--;
-        }
+        // grow [l, r] while b stays non-decreasing
+        r = run_end(b.data(), r, n);
+        l = run_start(b.data(), l, n);
         cout << l + 1 << " " << r + 1 << "\n";
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -1,10 +1,114 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-int main() {
+// In sorted order s[0..n), any median m gives
+//   sum |s[i] - m| = (sum of the top n/2 values) - (sum of the bottom n/2 values),
+// so the cost only needs to know which side of the middle every value is on.
+
+// Quickselect towards position n/2 that adds up each part it throws away
+// while partitioning, so no extra pass over the array is needed. Falls back
+// to nth_element if the pivots keep going bad (introselect).
+long long median_cost(vector<long long> &a) {
+    int n = a.size();
+    int half = n / 2;         // positions < half count negative
+    int upper = n - n / 2;    // positions >= upper count positive
+    auto weight = [&](long long pos) { return pos < half ? -1 : (pos >= upper ? 1 : 0); };
+
+    long long cost = 0;
+    int lo = 0, hi = n, budget = 2 * (__lg(max(n, 1)) + 1);
+    while (hi - lo > 16 && budget-- > 0) {
+        long long x = a[lo], y = a[lo + (hi - lo) / 2], z = a[hi - 1];
+        long long pivot = max(min(x, y), min(max(x, y), z));
+
+        // [lo, lt) < pivot, [lt, i) == pivot, [gt, hi) > pivot
+        int lt = lo, i = lo, gt = hi;
+        long long sum_less = 0, sum_greater = 0;
+        while (i < gt) {
+            long long v = a[i];
+            if (v < pivot) {
+                sum_less += v;
+                swap(a[lt++], a[i++]);
+            } else if (v > pivot) {
+                sum_greater += v;
+                swap(a[i], a[--gt]);
+            } else {
+                i++;
+            }
+        }
+
+        if (half < lt) {
+            // [gt, hi) and the pivots sit above position half
+            cost += sum_greater;
+            for (int p = lt; p < gt; p++) cost += weight(p) * pivot;
+            hi = lt;
+        } else if (half >= gt) {
+            cost -= sum_less;
+            for (int p = lt; p < gt; p++) cost += weight(p) * pivot;
+            lo = gt;
+        } else {
+            // the middle is a pivot copy, everything left of it is settled
+            cost += sum_greater - sum_less;
+            for (int p = lt; p < gt; p++) cost += weight(p) * pivot;
+            return cost;
+        }
+    }
+
+    if (half >= lo && half < hi) nth_element(a.begin() + lo, a.begin() + half, a.begin() + hi);
+    for (int p = lo; p < hi; p++) cost += weight(p) * a[p];
+    return cost;
+}
+
+// Streaming mode: values come one at a time and the cost is kept up to date.
+// low holds the smallest ceil(n/2) values, high the largest floor(n/2).
+struct StreamingMedian {
+    priority_queue<long long> low;
+    priority_queue<long long, vector<long long>, greater<long long>> high;
+    long long sum_low = 0, sum_high = 0;
+
+    void add(long long v) {
+        if (low.empty() || v <= low.top()) {
+            low.push(v);
+            sum_low += v;
+        } else {
+            high.push(v);
+            sum_high += v;
+        }
+        if (low.size() > high.size() + 1) {
+            sum_low -= low.top(), sum_high += low.top();
+            high.push(low.top());
+            low.pop();
+        } else if (high.size() > low.size()) {
+            sum_high -= high.top(), sum_low += high.top();
+            low.push(high.top());
+            high.pop();
+        }
+    }
+
+    long long median() const {
+        return low.size() > high.size() ? low.top() : (low.top() + high.top()) / 2;
+    }
+
+    long long cost() const {
+        // with an odd count the median itself sits in low and adds nothing
+        return sum_high - sum_low + (low.size() > high.size() ? low.top() : 0);
+    }
+};
+
+int main(int argc, char **argv) {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
 
+    // "--stream": read values until EOF, print median and cost after each one
+    if (argc > 1 && string(argv[1]) == "--stream") {
+        StreamingMedian sm;
+        long long v;
+        while (cin >> v) {
+            sm.add(v);
+            cout << sm.median() << ' ' << sm.cost() << '\n';
+        }
+        return 0;
+    }
+
     int n;
     cin >> n;
     vector<long long> a(n);
@@ -12,13 +116,6 @@ int main() {
         cin >> a[i];
     }
 
-    sort(a.begin(), a.end());
-    long long median = (n%2 == 0)? ((a[n / 2 - 1] + a[n / 2]) / 2) : a[n / 2];
-    long long cost = 0;
-    for (int i = 0; i < n; i++) {
-        cost += abs(a[i] - median);
-    }
-
-    cout << cost;
+    cout << median_cost(a);
     return 0;
-}
\ No newline at end of file
+}
@@ -1,79 +1,261 @@
 #include <bits/stdc++.h>
 using namespace std;
 
-int main() {
-    ios::sync_with_stdio(false);
-    cin.tie(nullptr);
-
-    int tt; 
-    cin >> tt;
-    while (tt--) {
-        int n;
-        cin >> n;
-        vector<long long> a(n);
-        for (int i = 0; i < n; i++) {
-            cin >> a[i];
+// Multiset of small values with O(1) MEX.
+// bits[0] has bit v set when v is present, and bits[k + 1] has bit w set
+// when word w of bits[k] is all ones. The top level is a single word, so the
+// MEX is one ctz of an inverted word per level. Values >= cap are ignored
+// (with n elements the MEX is at most n).
+struct MexSet {
+    int cap;
+    vector<int> cnt;
+    vector<vector<unsigned long long>> bits;
+
+    MexSet(int cap) : cap(cap), cnt(cap, 0) {
+        size_t words = (cap + 63) / 64;
+        bits.emplace_back(words, 0);
+        while (words > 1) {
+            words = (words + 63) / 64;
+            bits.emplace_back(words, 0);
         }
-        
-        map<long long, int> freq;
-        for (int i = 0; i < n; i++) {
-            freq[a[i]]++;
+    }
+
+    void set_bit(int v) {
+        for (size_t k = 0; k < bits.size(); k++) {
+            unsigned long long &w = bits[k][v >> 6];
+            w |= 1ULL << (v & 63);
+            if (w != ~0ULL) break;
+            v >>= 6;
         }
+    }
 
-        long long mex = 0;
-        while (freq[mex] > 0) {
-            mex++;
+    void clear_bit(int v) {
+        for (size_t k = 0; k < bits.size(); k++) {
+            unsigned long long &w = bits[k][v >> 6];
+            bool was_full = w == ~0ULL;
+            w &= ~(1ULL << (v & 63));
+            if (!was_full) break;
+            v >>= 6;
         }
+    }
 
-        bool mexPlusOneExists = freq[mex + 1] > 0;
+    void add(long long v, int times = 1) {
+        if (v < 0 || v >= cap || times == 0) return;
+        if (cnt[v] == 0) set_bit(v);
+        cnt[v] += times;
+    }
 
-        if (mexPlusOneExists) {
-            int l = -1, r = -1;
-            for (int i = 0; i < n; i++) {
-                if (a[i] == mex + 1) {
-                    if (l == -1) l = i;
-                    r = i;
-                }
+    void remove(long long v, int times = 1) {
+        if (v < 0 || v >= cap || times == 0) return;
+        if ((cnt[v] -= times) == 0) clear_bit(v);
+    }
+
+    int count(long long v) const { return v < 0 || v >= cap ? 0 : cnt[v]; }
+
+    int mex() const {
+        int w = 0;
+        for (int k = bits.size() - 1; k >= 0; k--) {
+            w = w * 64 + __builtin_ctzll(~bits[k][w]);
+        }
+        return w;
+    }
+};
+
+// Whole input in one buffer
+static vector<char> in_buf;
+
+void read_all() {
+    size_t cap = 1 << 16, len = 0;
+    in_buf.resize(cap);
+    while (size_t got = fread(in_buf.data() + len, 1, cap - len, stdin)) {
+        len += got;
+        if (len == cap) in_buf.resize(cap *= 2);
+    }
+    in_buf.resize(len);
+    in_buf.push_back(0);
+}
+
+// Integers from some point of in_buf on
+struct Reader {
+    const char *p;
+
+    long long next_int() {
+        while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+        bool neg = *p == '-';
+        if (neg) ++p;
+        long long x = 0;
+        while (*p >= '0' && *p <= '9') x = x * 10 + (*p++ - '0');
+        return neg ? -x : x;
+    }
+
+    // pass over k integers without converting them
+    void skip(long long k) {
+        while (k-- > 0) {
+            while (*p && *p != '-' && (*p < '0' || *p > '9')) ++p;
+            if (*p == '-') ++p;
+            while (*p >= '0' && *p <= '9') ++p;
+        }
+    }
+};
+
+// Multi-test runner, the same as in lvl2/module_2/day2_1.cpp: one input
+// span per case (found with skip_case), solve(r, out) on a work-stealing
+// pool, answers written out in input order.
+template <class Skip, class Solve>
+void run_cases(Skip skip_case, Solve solve) {
+    read_all();
+    Reader in{in_buf.data()};
+    int T = in.next_int();
+    vector<const char *> start(T + 1);
+    for (int c = 0; c < T; c++) {
+        start[c] = in.p;
+        skip_case(in);
+    }
+    start[T] = in.p;
+
+    int threads = max(1, min<int>(thread::hardware_concurrency(), T));
+
+    // cases [lo, hi) still to do, the owner takes lo, thieves take the back half
+    struct Range {
+        mutex m;
+        int lo = 0, hi = 0;
+    };
+    vector<Range> ranges(threads);
+    size_t bytes = start[T] - start[0];
+    for (int t = 0, c = 0; t < threads; t++) {
+        size_t goal = bytes * (t + 1) / threads;
+        ranges[t].lo = c;
+        while (c < T && (size_t)(start[c + 1] - start[0]) <= goal) c++;
+        if (t == threads - 1) c = T;
+        ranges[t].hi = c;
+    }
+
+    auto take = [&](int t, int &c) {
+        lock_guard<mutex> g(ranges[t].m);
+        if (ranges[t].lo == ranges[t].hi) return false;
+        c = ranges[t].lo++;
+        return true;
+    };
+    auto steal = [&](int t) {
+        for (int k = 1; k < threads; k++) {
+            Range &victim = ranges[(t + k) % threads];
+            int lo, hi;
+            {
+                lock_guard<mutex> g(victim.m);
+                if (victim.lo == victim.hi) continue;
+                hi = victim.hi;
+                lo = hi - (hi - victim.lo + 1) / 2;
+                victim.hi = lo;
             }
-            for (int i = l; i <= r; i++) {
-                a[i] = mex;
+            lock_guard<mutex> g(ranges[t].m);
+            ranges[t].lo = lo, ranges[t].hi = hi;
+            return true;
+        }
+        return false;
+    };
+
+    // answer of case c is out[piece[c].t] from piece[c].from to piece[c].to
+    struct Piece {
+        int t;
+        size_t from, to;
+    };
+    vector<string> out(threads);
+    vector<Piece> piece(T);
+    auto worker = [&](int t) {
+        int c;
+        do {
+            while (take(t, c)) {
+                Reader r{start[c]};
+                size_t from = out[t].size();
+                solve(r, out[t]);
+                piece[c] = {t, from, out[t].size()};
             }
-        } else {
-            bool found = false;
+        } while (steal(t));
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto &th : pool) th.join();
+
+    size_t total = 0;
+    for (auto &s : out) total += s.size();
+    string all;
+    all.reserve(total);
+    for (int c = 0; c < T; c++) all.append(out[piece[c].t], piece[c].from, piece[c].to - piece[c].from);
+    fwrite(all.data(), 1, all.size(), stdout);
+}
+
+// One case: n, then a
+void solve(Reader &in, string &out) {
+    int n = in.next_int();
+    vector<long long> a(n);
+    for (int i = 0; i < n; i++) {
+        a[i] = in.next_int();
+    }
+
+    // values 0..n+1 matter: the MEX and the MEX + 1 we look for
+    MexSet freq(n + 2);
+    vector<int> first(n + 2, -1), last(n + 2, -1);
+    unordered_map<long long, int> negative; // MexSet ignores these, but a repeated one can be picked
+    for (int i = 0; i < n; i++) {
+        freq.add(a[i]);
+        if (a[i] < 0) negative[a[i]]++;
+        if (0 <= a[i] && a[i] <= n + 1) {
+            if (first[a[i]] == -1) first[a[i]] = i;
+            last[a[i]] = i;
+        }
+    }
+
+    long long mex = freq.mex();
+
+    bool mexPlusOneExists = freq.count(mex + 1) > 0;
+
+    if (mexPlusOneExists) {
+        int l = first[mex + 1], r = last[mex + 1];
+        // one update per run of equal values in the span
+        for (int i = l; i <= r;) {
+            int j = i;
+            while (j <= r && a[j] == a[i]) j++;
+            freq.remove(a[i], j - i);
+            fill(a.begin() + i, a.begin() + j, mex);
+            i = j;
+        }
+        freq.add(mex, r - l + 1);
+    } else {
+        int pick = -1;
+        for (int i = 0; i < n; i++) {
+            int c = a[i] < 0 ? negative[a[i]] : freq.count(a[i]);
+            if (c > 1 && a[i] < mex) {
+                pick = i;
+                break;
+            }
+        }
+        if (pick == -1) {
             for (int i = 0; i < n; i++) {
-                if (freq[a[i]] > 1 && a[i] < mex) {
-                    a[i] = mex;
-                    found = true;
+                if (a[i] > mex + 1) {
+                    pick = i;
                     break;
                 }
             }
-            if (!found) {
-                for (int i = 0; i < n; i++) {
-                    if (a[i] > mex + 1) {
-                        a[i] = mex;
-                        found = true;
-                        break;
-                    }
-                }
-            }
         }
-
-        freq.clear();
-        for (int i = 0; i < n; i++) {
-            freq[a[i]]++;
+        if (pick != -1) {
+            freq.remove(a[pick]);
+            a[pick] = mex;
+            freq.add(mex);
         }
+    }
 
-        long long newMex = 0;
-        while (freq[newMex] > 0) {
-            newMex++;
-        }
+    long long newMex = freq.mex();
 
-        if (newMex == mex + 1) {
-            cout << "YES\n";
-        } else {
-            cout << "NO\n";
-        }
+    if (newMex == mex + 1) {
+        out += "YES\n";
+    } else {
+        out += "NO\n";
     }
+}
 
+int main() {
+    run_cases([](Reader &in) { in.skip(in.next_int()); }, solve);
     return 0;
 }
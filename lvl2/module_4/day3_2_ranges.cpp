@@ -0,0 +1,126 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+using i128 = __int128_t;
+
+// day3_2 answers sum |a_i - a_j| over all pairs of a sorted array with one
+// running prefix sum. This does the same for many ranges [l, r] of an
+// unsorted array, offline: queries are visited in Mo's order and the window
+// is kept in a Fenwick tree over compressed values holding (count, sum), so
+// moving an end by one costs O(log n), and a query O(sqrt(n) log n) amortized.
+// Sums of up to n values of 64 bits don't fit in 64 bits, so every sum is i128.
+
+void print_int128(i128 x) {
+    if (x == 0) { std::cout << 0; return; }
+    if (x < 0) { std::cout << '-'; x = -x; }
+    std::string s;
+    while (x) { s.push_back(char('0' + x % 10)); x /= 10; }
+    std::reverse(s.begin(), s.end());
+    std::cout << s;
+}
+
+// Count and sum live side by side so one walk answers both. The sum is a
+// 128-bit two's complement number kept as two words, which makes a node
+// 24 bytes instead of the 32 an aligned i128 would take.
+struct Fenwick {
+    struct Node {
+        long long cnt;
+        unsigned long long lo, hi;
+        void add(long long c, unsigned long long vlo, unsigned long long vhi) {
+            cnt += c;
+            lo += vlo;
+            hi += vhi + (lo < vlo);
+        }
+    };
+    int n;
+    vector<Node> t;
+    Fenwick(int n) : n(n), t(n + 1, Node{0, 0, 0}) {}
+    // c copies of v come in (c = 1) or go out (c = -1)
+    void add(int i, long long c, long long v) {
+        unsigned long long vlo = v, vhi = v < 0 ? ~0ULL : 0;
+        if (c < 0) vhi = ~vhi + (vlo == 0), vlo = -vlo;
+        for (++i; i <= n; i += i & -i) t[i].add(c, vlo, vhi);
+    }
+    // (count, sum) over [0, i)
+    pair<long long, i128> query(int i) const {
+        Node s{0, 0, 0};
+        for (; i > 0; i -= i & -i) s.add(t[i].cnt, t[i].lo, t[i].hi);
+        return {s.cnt, (i128)((unsigned __int128)s.hi << 64 | s.lo)};
+    }
+};
+
+int main() {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
+    int n, q;
+    cin >> n >> q;
+    vector<long long> a(n);
+    for (int i = 0; i < n; ++i)
+        cin >> a[i];
+
+    // compress values
+    vector<long long> vals = a;
+    sort(vals.begin(), vals.end());
+    vals.erase(unique(vals.begin(), vals.end()), vals.end());
+    vector<int> id(n);
+    for (int i = 0; i < n; ++i)
+        id[i] = lower_bound(vals.begin(), vals.end(), a[i]) - vals.begin();
+
+    vector<int> ql(q), qr(q), order(q);
+    for (int i = 0; i < q; ++i) {
+        cin >> ql[i] >> qr[i];
+        --ql[i], --qr[i];
+        order[i] = i;
+    }
+
+    // Mo's order, with every other block walked backwards
+    int block = max(1, (int)(n / sqrt(max(q, 1))));
+    sort(order.begin(), order.end(), [&](int x, int y) {
+        int bx = ql[x] / block, by = ql[y] / block;
+        if (bx != by) return bx < by;
+        return (bx & 1) ? qr[x] > qr[y] : qr[x] < qr[y];
+    });
+
+    Fenwick fw(vals.size());
+    long long window_cnt = 0;
+    i128 window_sum = 0;
+    i128 cur = 0;
+
+    // sum |a[i] - y| over the y in the window (a[i] itself not in it).
+    // Values equal to a[i] add 0 on either side, so they go with the greater ones.
+    auto dist_to_window = [&](int i) -> i128 {
+        i128 x = a[i];
+        auto [less, sum_less] = fw.query(id[i]);
+        long long greater = window_cnt - less;
+        i128 sum_greater = window_sum - sum_less;
+        return x * less - sum_less + sum_greater - x * greater;
+    };
+    auto add = [&](int i) {
+        cur += dist_to_window(i);
+        fw.add(id[i], 1, a[i]);
+        window_cnt++, window_sum += a[i];
+    };
+    auto remove = [&](int i) {
+        fw.add(id[i], -1, a[i]);
+        window_cnt--, window_sum -= a[i];
+        cur -= dist_to_window(i);
+    };
+
+    vector<i128> result(q);
+    int L = 0, R = -1; // current window [L, R]
+    for (int k : order) {
+        while (R < qr[k]) add(++R);
+        while (L > ql[k]) add(--L);
+        while (R > qr[k]) remove(R--);
+        while (L < ql[k]) remove(L++);
+        result[k] = cur;
+    }
+
+    for (int i = 0; i < q; ++i) {
+        print_int128(result[i]);
+        cout << '\n';
+    }
+
+    return 0;
+}
@@ -5,6 +5,10 @@ int main () {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
 
+    // reused by every test case
+    vector<char> buf;
+    vector<int> ans;
+
     int tt;
     cin >> tt;
     while (tt--) {
@@ -24,42 +28,45 @@ int main () {
             continue;
         }
 
-        vector<int> ans;
-        deque<char> dq;
-        for (int i = 0; i < s.length(); i++) {
-            dq.push_back(s[i]);
-        }
+        // Simulate on one flat buffer with head/tail indices instead of a deque.
+        // The process never needs more than n / 2 operations of 2 characters,
+        // so n spare slots on each side are always enough.
+        buf.resize(3 * n);
+        int head = n, tail = 2 * n; // current string is buf[head, tail)
+        copy(s.begin(), s.end(), buf.begin() + head);
+        ans.clear();
+        ans.reserve(n / 2);
 
         int d = 0;
-        while (!dq.empty()) {
-            if (dq.front() == dq.back()) {
-                if (dq.front() == '0') {
-                    dq.push_back('0');
-                    dq.push_back('1');
+        while (head < tail) {
+            if (buf[head] == buf[tail - 1]) {
+                if (buf[head] == '0') {
+                    buf[tail++] = '0';
+                    buf[tail++] = '1';
                     ans.push_back(n-d);
                 } else {
-                    dq.push_front('1');
-                    dq.push_front('0');
+                    buf[--head] = '1';
+                    buf[--head] = '0';
                     ans.push_back(0+d);
                 }
                 n+=2;
             }
-            while (!dq.empty() && dq.front() != dq.back()) {
-                dq.pop_front();
-                dq.pop_back();
+            while (head < tail && buf[head] != buf[tail - 1]) {
+                ++head;
+                --tail;
                 ++d;
             }
         }
 
-        cout << ans.size() << endl;
+        cout << ans.size() << "\n";
         if (ans.size() == 0) {
-            cout << endl;
+            cout << "\n";
             continue;
         }
         for (auto x : ans) {
             cout << x << " ";
         }
-        cout << endl;
+        cout << "\n";
     }
     return 0;
 }
\ No newline at end of file